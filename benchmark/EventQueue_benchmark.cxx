@@ -0,0 +1,160 @@
+/**
+ * @file EventQueue_benchmark.cxx
+ * @author Dirk Ziegelmeier (dirk@ziegelmeier.net)
+ * @brief
+ * @date 16-10-2026
+ *
+ * @copyright SPDX-License-Identifier: Apache-2.0
+ *
+ */
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cpp_active_objects/ActiveObjectBase.hxx>
+#include <cpp_active_objects/EventQueue.hxx>
+#include <cpp_active_objects/IntrusiveEventQueue.hxx>
+#include <cpp_active_objects/LockFreeEventQueue.hxx>
+#include <cpp_active_objects/SingleThreadActiveObjectDomain.hxx>
+#include <cpp_event_framework/Signal.hxx>
+
+namespace
+{
+class BenchmarkEvent : public cpp_event_framework::SignalBase<BenchmarkEvent, 0>
+{
+};
+
+class LinkableBenchmarkEvent
+    : public cpp_event_framework::SignalBase<LinkableBenchmarkEvent, 1, cpp_active_objects::LinkableSignal>
+{
+};
+
+class CountingActiveObject : public cpp_active_objects::ActiveObjectBase
+{
+public:
+    void Dispatch(const cpp_event_framework::Signal::SPtr& /*event*/) override
+    {
+        count_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    std::atomic<size_t> count_ = 0;
+};
+
+// with_handle: target is addressed by handle, Take() does no reference counting on it
+void RunProducers(const std::string& name, const cpp_active_objects::IEventQueue::SPtr& queue, size_t producers,
+                  size_t events_per_producer, bool with_handle = false)
+{
+    auto target = std::make_shared<CountingActiveObject>();
+    auto domain = std::make_shared<cpp_active_objects::SingleThreadActiveObjectDomain<>>(queue);
+    if (with_handle)
+    {
+        domain->RegisterObjectWithHandle(target);
+    }
+    else
+    {
+        domain->RegisterObject(target);
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    {
+        std::vector<std::jthread> threads;
+        for (size_t p = 0; p < producers; p++)
+        {
+            threads.emplace_back(
+                [target, events_per_producer]()
+                {
+                    // One event per producer, the benchmark measures the queue and not the event allocator
+                    const cpp_event_framework::Signal::SPtr event = BenchmarkEvent::MakeShared();
+                    for (size_t i = 0; i < events_per_producer; i++)
+                    {
+                        target->Take(event);
+                    }
+                });
+        }
+    }
+    while (target->count_.load(std::memory_order_relaxed) != producers * events_per_producer)
+    {
+        std::this_thread::yield();
+    }
+    const auto duration = std::chrono::steady_clock::now() - start;
+
+    const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+    std::cout << name << " producers=" << producers << ": "
+              << static_cast<double>(ns) / static_cast<double>(producers * events_per_producer) << " ns/event\n";
+}
+
+// Every Take() uses a different, pre-allocated event, so an intrusive queue can link each of them in
+template <typename Event>
+void RunDistinctEvents(const std::string& name, const cpp_active_objects::IEventQueue::SPtr& queue, size_t producers,
+                       size_t events_per_producer)
+{
+    auto target = std::make_shared<CountingActiveObject>();
+    auto domain = std::make_shared<cpp_active_objects::SingleThreadActiveObjectDomain<>>(queue);
+    domain->RegisterObject(target);
+
+    std::vector<std::vector<cpp_event_framework::Signal::SPtr>> events(producers);
+    for (auto& producer_events : events)
+    {
+        for (size_t i = 0; i < events_per_producer; i++)
+        {
+            producer_events.emplace_back(Event::MakeShared());
+        }
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    {
+        std::vector<std::jthread> threads;
+        for (const auto& producer_events : events)
+        {
+            threads.emplace_back(
+                [target, &producer_events]()
+                {
+                    for (const auto& event : producer_events)
+                    {
+                        target->Take(event);
+                    }
+                });
+        }
+    }
+    while (target->count_.load(std::memory_order_relaxed) != producers * events_per_producer)
+    {
+        std::this_thread::yield();
+    }
+    const auto duration = std::chrono::steady_clock::now() - start;
+
+    const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+    std::cout << name << " producers=" << producers << ": "
+              << static_cast<double>(ns) / static_cast<double>(producers * events_per_producer) << " ns/event\n";
+}
+} // namespace
+
+void EventQueueBenchmarkMain()
+{
+    constexpr size_t kEventsPerProducer = 200000;
+
+    for (size_t producers : {1, 2, 4, 8})
+    {
+        RunProducers("EventQueue                 ", std::make_shared<cpp_active_objects::EventQueue<>>(),
+                     producers, kEventsPerProducer);
+        RunProducers("LockFreeEventQueue         ", std::make_shared<cpp_active_objects::LockFreeEventQueue<>>(),
+                     producers, kEventsPerProducer);
+        RunProducers("LockFreeEventQueue (handle)", std::make_shared<cpp_active_objects::LockFreeEventQueue<>>(),
+                     producers, kEventsPerProducer, true);
+    }
+
+    constexpr size_t kDistinctEventsPerProducer = 50000;
+    for (size_t producers : {1, 4})
+    {
+        RunDistinctEvents<BenchmarkEvent>("EventQueue          (distinct events)",
+                                          std::make_shared<cpp_active_objects::EventQueue<>>(), producers,
+                                          kDistinctEventsPerProducer);
+        RunDistinctEvents<LinkableBenchmarkEvent>("IntrusiveEventQueue (distinct events)",
+                                                  std::make_shared<cpp_active_objects::IntrusiveEventQueue<>>(),
+                                                  producers, kDistinctEventsPerProducer);
+    }
+}
@@ -0,0 +1,107 @@
+/**
+ * @file Pool_benchmark.cxx
+ * @author Dirk Ziegelmeier (dirk@ziegelmeier.net)
+ * @brief
+ * @date 16-10-2026
+ *
+ * @copyright SPDX-License-Identifier: Apache-2.0
+ *
+ */
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <memory_resource>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <vector>
+
+#include <cpp_event_framework/Pool.hxx>
+
+namespace
+{
+/**
+ * @brief Reference: previous Pool free list (FIFO std::queue), always hands out the coldest element
+ */
+class FifoQueuePool : public std::pmr::memory_resource
+{
+public:
+    FifoQueuePool(size_t element_size, size_t count) : pool_mem_(element_size * count)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            pool_.push(&pool_mem_.at(i * element_size));
+        }
+    }
+
+    void* do_allocate(size_t /*bytes*/, size_t /*alignment*/) override
+    {
+        std::scoped_lock lock(mutex_);
+        auto* result = pool_.front();
+        pool_.pop();
+        return result;
+    }
+
+    void do_deallocate(void* p, size_t /*bytes*/, size_t /*alignment*/) override
+    {
+        std::scoped_lock lock(mutex_);
+        pool_.push(p);
+    }
+
+    bool do_is_equal(const memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+
+private:
+    std::vector<uint8_t> pool_mem_;
+    std::queue<void*> pool_;
+    std::mutex mutex_;
+};
+
+constexpr size_t kElementSize = 256;
+// 16 MB of elements - larger than typical last level caches
+constexpr size_t kPoolElements = 65536;
+
+void RunPool(const std::string& name, std::pmr::memory_resource& pool, size_t burst, size_t rounds)
+{
+    std::vector<void*> elements(burst);
+
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t round = 0; round < rounds; round++)
+    {
+        for (auto& element : elements)
+        {
+            element = pool.allocate(kElementSize);
+            // Touch the element like a signal constructor would
+            memset(element, static_cast<int>(round), kElementSize);
+        }
+        for (auto* element : elements)
+        {
+            pool.deallocate(element, kElementSize);
+        }
+    }
+    const auto duration = std::chrono::steady_clock::now() - start;
+
+    const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+    std::cout << name << " burst=" << burst << ": "
+              << static_cast<double>(ns) / static_cast<double>(burst * rounds) << " ns/alloc+free\n";
+}
+} // namespace
+
+void PoolBenchmarkMain()
+{
+    constexpr size_t kOperations = 4000000;
+
+    // FIFO reuse walks through the whole pool memory (cache misses on every allocation),
+    // LIFO reuse keeps hitting the same few cache-hot elements
+    for (size_t burst : {1, 16, 256})
+    {
+        FifoQueuePool fifo(kElementSize, kPoolElements);
+        cpp_event_framework::Pool<> lifo(kElementSize, kPoolElements, "Pool");
+
+        RunPool("FIFO std::queue pool  ", fifo, burst, kOperations / burst);
+        RunPool("Pool (intrusive LIFO) ", lifo, burst, kOperations / burst);
+    }
+}
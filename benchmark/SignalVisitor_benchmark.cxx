@@ -0,0 +1,97 @@
+/**
+ * @file SignalVisitor_benchmark.cxx
+ * @author Dirk Ziegelmeier (dirk@ziegelmeier.net)
+ * @brief
+ * @date 16-10-2026
+ *
+ * @copyright SPDX-License-Identifier: Apache-2.0
+ *
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <cpp_event_framework/Signal.hxx>
+#include <cpp_event_framework/SignalVisitor.hxx>
+
+namespace
+{
+constexpr size_t kNumSignals = 64;
+
+template <size_t Index>
+class BenchmarkSignal : public cpp_event_framework::SignalBase<BenchmarkSignal<Index>, Index>
+{
+public:
+    size_t value_ = Index;
+};
+
+// Typical handler: chain of Check()/FromSignal() comparisons
+template <size_t... Indices>
+size_t IfElseChain(const cpp_event_framework::Signal::SPtr& event, std::index_sequence<Indices...> /*indices*/)
+{
+    size_t result = 0;
+    ((BenchmarkSignal<Indices>::Check(event) ? (result = BenchmarkSignal<Indices>::FromSignal(event)->value_, true)
+                                             : false) ||
+     ...);
+    return result;
+}
+
+template <size_t... Indices>
+auto MakeVisitor(std::index_sequence<Indices...> /*indices*/)
+{
+    return cpp_event_framework::MakeSignalVisitor<size_t>(
+        [](const cpp_event_framework::Signal& /*event*/) -> size_t { return 0; },
+        cpp_event_framework::On<BenchmarkSignal<Indices>>([](const BenchmarkSignal<Indices>& event) -> size_t
+                                                          { return event.value_; })...);
+}
+
+template <size_t... Indices>
+std::vector<cpp_event_framework::Signal::SPtr> MakeEvents(std::index_sequence<Indices...> /*indices*/)
+{
+    return {BenchmarkSignal<Indices>::MakeShared()...};
+}
+
+template <typename Function>
+void Run(const std::string& name, const std::vector<cpp_event_framework::Signal::SPtr>& events, Function function)
+{
+    size_t sum = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (const auto& event : events)
+    {
+        sum += function(event);
+    }
+    const auto duration = std::chrono::steady_clock::now() - start;
+
+    const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+    std::cout << name << ": " << static_cast<double>(ns) / static_cast<double>(events.size())
+              << " ns/dispatch (checksum " << sum << ")\n";
+}
+} // namespace
+
+void SignalVisitorBenchmarkMain()
+{
+    constexpr size_t kDispatches = 4000000;
+    constexpr auto kIndices = std::make_index_sequence<kNumSignals>();
+
+    // Uniformly distributed signal types, so branch prediction cannot learn the sequence
+    auto signals = MakeEvents(kIndices);
+    std::mt19937 random(42);
+    std::uniform_int_distribution<size_t> distribution(0, kNumSignals - 1);
+    std::vector<cpp_event_framework::Signal::SPtr> events;
+    events.reserve(kDispatches);
+    for (size_t i = 0; i < kDispatches; i++)
+    {
+        events.emplace_back(signals.at(distribution(random)));
+    }
+
+    const auto visitor = MakeVisitor(kIndices);
+    Run("if/else Check/FromSignal chain (64 signals)", events,
+        [kIndices](const cpp_event_framework::Signal::SPtr& event) { return IfElseChain(event, kIndices); });
+    Run("SignalVisitor jump table (64 signals)      ", events,
+        [&visitor](const cpp_event_framework::Signal::SPtr& event) { return visitor(event); });
+}
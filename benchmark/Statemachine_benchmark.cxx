@@ -0,0 +1,187 @@
+/**
+ * @file Statemachine_benchmark.cxx
+ * @author Dirk Ziegelmeier (dirk@ziegelmeier.net)
+ * @brief
+ * @date 16-10-2026
+ *
+ * @copyright SPDX-License-Identifier: Apache-2.0
+ *
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <string>
+
+#include <cpp_event_framework/Statemachine.hxx>
+#include <cpp_event_framework/StaticStatemachine.hxx>
+
+namespace
+{
+enum class EEvent
+{
+    kToggle,
+    kIgnored
+};
+
+// Counts calls, fully inlined into React()
+class CountingTracer : public cpp_event_framework::NoStatemachineHooks
+{
+public:
+    static inline size_t count_ = 0;
+
+    template <typename Fsm>
+    static void OnHandleEvent(const Fsm& /*fsm*/, typename Fsm::StateRef /*state*/, EEvent /*event*/)
+    {
+        count_++;
+    }
+};
+
+template <typename Hooks>
+class BenchmarkFsm
+    : public cpp_event_framework::Statemachine<BenchmarkFsm<Hooks>, EEvent, 8,
+                                               cpp_event_framework::DefaultAssertionProvider, Hooks>
+{
+public:
+    using Base = cpp_event_framework::Statemachine<BenchmarkFsm<Hooks>, EEvent, 8,
+                                                   cpp_event_framework::DefaultAssertionProvider, Hooks>;
+
+    static const typename Base::State kTop;
+    static const typename Base::State kOff;
+    static const typename Base::State kOn;
+
+    size_t toggles_ = 0;
+
+private:
+    static typename Base::Transition TopHandler(BenchmarkFsm* /*impl*/, EEvent /*event*/)
+    {
+        return Base::NoTransition();
+    }
+    static typename Base::Transition OffHandler(BenchmarkFsm* impl, EEvent event)
+    {
+        if (event != EEvent::kToggle)
+        {
+            return Base::UnhandledEvent();
+        }
+        impl->toggles_++;
+        return Base::TransitionTo(kOn);
+    }
+    static typename Base::Transition OnHandler(BenchmarkFsm* /*impl*/, EEvent event)
+    {
+        return (event == EEvent::kToggle) ? Base::TransitionTo(kOff) : Base::UnhandledEvent();
+    }
+};
+
+template <typename Hooks>
+const typename BenchmarkFsm<Hooks>::Base::State BenchmarkFsm<Hooks>::kTop("Top", &BenchmarkFsm::TopHandler, nullptr,
+                                                                          &BenchmarkFsm::kOff);
+template <typename Hooks>
+const typename BenchmarkFsm<Hooks>::Base::State BenchmarkFsm<Hooks>::kOff("Off", &BenchmarkFsm::OffHandler,
+                                                                          &BenchmarkFsm::kTop);
+template <typename Hooks>
+const typename BenchmarkFsm<Hooks>::Base::State BenchmarkFsm<Hooks>::kOn("On", &BenchmarkFsm::OnHandler,
+                                                                         &BenchmarkFsm::kTop);
+
+// Same statemachine with the type-based engine
+struct StaticTop;
+struct StaticOff;
+struct StaticOn;
+struct StaticTop : cpp_event_framework::StaticState<void, StaticOff>
+{
+    static constexpr const char* kName = "Top";
+};
+struct StaticOff : cpp_event_framework::StaticState<StaticTop>
+{
+    static constexpr const char* kName = "Off";
+};
+struct StaticOn : cpp_event_framework::StaticState<StaticTop>
+{
+    static constexpr const char* kName = "On";
+};
+
+class StaticBenchmarkFsm
+{
+public:
+    using Fsm =
+        cpp_event_framework::StaticStatemachine<StaticBenchmarkFsm, EEvent,
+                                                cpp_event_framework::StaticStates<StaticTop, StaticOff, StaticOn>>;
+
+    Fsm fsm_;
+    size_t toggles_ = 0;
+
+    Fsm::Transition Handle(StaticTop /*state*/, EEvent /*event*/)
+    {
+        return Fsm::NoTransition();
+    }
+    Fsm::Transition Handle(StaticOff /*state*/, EEvent event)
+    {
+        if (event != EEvent::kToggle)
+        {
+            return Fsm::UnhandledEvent();
+        }
+        toggles_++;
+        return Fsm::TransitionTo<StaticOn>();
+    }
+    Fsm::Transition Handle(StaticOn /*state*/, EEvent event)
+    {
+        return (event == EEvent::kToggle) ? Fsm::TransitionTo<StaticOff>() : Fsm::UnhandledEvent();
+    }
+};
+
+template <typename Hooks>
+void RunReact(const std::string& name, size_t iterations, void (*setup)(BenchmarkFsm<Hooks>&))
+{
+    BenchmarkFsm<Hooks> fsm;
+    setup(fsm);
+    fsm.Init(&fsm, "BenchmarkFsm");
+    fsm.Start(&BenchmarkFsm<Hooks>::kOff);
+
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; i++)
+    {
+        // Every other event is passed up to the top state, the others cause a transition
+        fsm.React(((i & 1U) == 0) ? EEvent::kToggle : EEvent::kIgnored);
+    }
+    const auto duration = std::chrono::steady_clock::now() - start;
+
+    const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+    std::cout << name << " (" << sizeof(fsm) << " bytes): "
+              << static_cast<double>(ns) / static_cast<double>(iterations) << " ns/React (toggles " << fsm.toggles_
+              << ")\n";
+}
+} // namespace
+
+void StatemachineBenchmarkMain()
+{
+    constexpr size_t kIterations = 10000000;
+
+    using Runtime = cpp_event_framework::RuntimeStatemachineHooks;
+    RunReact<Runtime>("Runtime hooks, none set  ", kIterations, [](BenchmarkFsm<Runtime>& /*fsm*/) {});
+    RunReact<Runtime>("Runtime hooks, tracer set", kIterations,
+                      [](BenchmarkFsm<Runtime>& fsm)
+                      {
+                          fsm.on_handle_event_ = [](BenchmarkFsm<Runtime>::Ref /*fsm*/,
+                                                    BenchmarkFsm<Runtime>::StateRef /*state*/, EEvent /*event*/)
+                          { CountingTracer::count_++; };
+                      });
+    RunReact<cpp_event_framework::NoStatemachineHooks>(
+        "NoStatemachineHooks      ", kIterations,
+        [](BenchmarkFsm<cpp_event_framework::NoStatemachineHooks>& /*fsm*/) {});
+    RunReact<CountingTracer>("Compile-time tracer      ", kIterations,
+                             [](BenchmarkFsm<CountingTracer>& /*fsm*/) {});
+    std::cout << "Tracer calls: " << CountingTracer::count_ << "\n";
+
+    StaticBenchmarkFsm static_fsm;
+    static_fsm.fsm_.Init(&static_fsm, "StaticBenchmarkFsm");
+    static_fsm.fsm_.Start<StaticOff>();
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < kIterations; i++)
+    {
+        static_fsm.fsm_.React(((i & 1U) == 0) ? EEvent::kToggle : EEvent::kIgnored);
+    }
+    const auto duration = std::chrono::steady_clock::now() - start;
+    const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+    std::cout << "StaticStatemachine        (" << sizeof(static_fsm.fsm_)
+              << " bytes): " << static_cast<double>(ns) / static_cast<double>(kIterations)
+              << " ns/React (toggles " << static_fsm.toggles_ << ")\n";
+}
@@ -0,0 +1,104 @@
+/**
+ * @file WaitStrategy_benchmark.cxx
+ * @author Dirk Ziegelmeier (dirk@ziegelmeier.net)
+ * @brief
+ * @date 16-10-2026
+ *
+ * @copyright SPDX-License-Identifier: Apache-2.0
+ *
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <semaphore>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cpp_active_objects/ActiveObjectBase.hxx>
+#include <cpp_active_objects/EventQueue.hxx>
+#include <cpp_active_objects/SingleThreadActiveObjectDomain.hxx>
+#include <cpp_event_framework/Signal.hxx>
+#include <cpp_event_framework/WaitStrategy.hxx>
+
+namespace
+{
+class StampedEvent : public cpp_event_framework::SignalBase<StampedEvent, 0>
+{
+public:
+    std::chrono::steady_clock::time_point sent_;
+};
+
+class LatencyRecordingObject : public cpp_active_objects::ActiveObjectBase
+{
+public:
+    explicit LatencyRecordingObject(size_t samples)
+    {
+        latencies_.reserve(samples);
+    }
+
+    void Dispatch(const cpp_event_framework::Signal::SPtr& event) override
+    {
+        const auto now = std::chrono::steady_clock::now();
+        latencies_.emplace_back(now - StampedEvent::FromSignal(event)->sent_);
+        count_.fetch_add(1, std::memory_order_release);
+    }
+
+    std::vector<std::chrono::steady_clock::duration> latencies_;
+    std::atomic<size_t> count_ = 0;
+};
+
+// Take() to Dispatch() latency. One event at a time, the pause before each event lets the consumer go idle
+// (spinning or parked, depending on wait strategy and pause length).
+template <typename SemaphoreType>
+void RunLatency(const std::string& name, size_t samples, std::chrono::microseconds pause)
+{
+    auto target = std::make_shared<LatencyRecordingObject>(samples);
+    std::vector<StampedEvent::SPtr> events(samples);
+    std::generate(events.begin(), events.end(), []() { return StampedEvent::MakeShared(); });
+
+    {
+        auto domain = std::make_shared<cpp_active_objects::SingleThreadActiveObjectDomain<>>(
+            std::make_shared<cpp_active_objects::EventQueue<SemaphoreType>>());
+        domain->RegisterObject(target);
+
+        for (size_t i = 0; i < samples; i++)
+        {
+            std::this_thread::sleep_for(pause);
+            events.at(i)->sent_ = std::chrono::steady_clock::now();
+            target->Take(events.at(i));
+            while (target->count_.load(std::memory_order_acquire) != i + 1)
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    auto& latencies = target->latencies_;
+    std::sort(latencies.begin(), latencies.end());
+    const auto percentile = [&latencies](size_t per_mille)
+    {
+        const auto index = std::min(latencies.size() - 1, (latencies.size() * per_mille) / 1000);
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(latencies.at(index)).count();
+    };
+    std::cout << name << " pause=" << pause.count() << "us: p50=" << percentile(500) << "ns p90=" << percentile(900)
+              << "ns p99=" << percentile(990) << "ns p99.9=" << percentile(999) << "ns max=" << percentile(1000)
+              << "ns\n";
+}
+} // namespace
+
+void WaitStrategyBenchmarkMain()
+{
+    constexpr size_t kSamples = 2000;
+
+    for (auto pause : {std::chrono::microseconds(10), std::chrono::microseconds(500)})
+    {
+        RunLatency<std::binary_semaphore>("binary_semaphore (default)", kSamples, pause);
+        RunLatency<cpp_event_framework::BlockingSemaphore>("BlockingSemaphore         ", kSamples, pause);
+        RunLatency<cpp_event_framework::SpinThenParkSemaphore<>>("SpinThenParkSemaphore     ", kSamples, pause);
+        RunLatency<cpp_event_framework::BusyPollSemaphore>("BusyPollSemaphore         ", kSamples, pause);
+    }
+}
@@ -0,0 +1,37 @@
+/**
+ * @file main.cxx
+ * @author Dirk Ziegelmeier (dirk@ziegelmeier.net)
+ * @brief
+ * @date 16-10-2026
+ *
+ * @copyright SPDX-License-Identifier: Apache-2.0
+ *
+ */
+
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+
+extern void EventQueueBenchmarkMain();
+extern void PoolBenchmarkMain();
+extern void SignalVisitorBenchmarkMain();
+extern void StatemachineBenchmarkMain();
+extern void WaitStrategyBenchmarkMain();
+
+int main(int, const char**)
+{
+    try
+    {
+        EventQueueBenchmarkMain();
+        PoolBenchmarkMain();
+        SignalVisitorBenchmarkMain();
+        StatemachineBenchmarkMain();
+        WaitStrategyBenchmarkMain();
+    }
+    catch (const std::exception& ex)
+    {
+        std::cout << ex.what() << std::endl;
+        exit(EXIT_FAILURE);
+    }
+    exit(EXIT_SUCCESS);
+}
@@ -10,10 +10,17 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <cstddef>
 #include <memory>
+#include <span>
+#include <thread>
 
 #include <cpp_active_objects/IActiveObject.hxx>
-#include <cpp_active_objects/IEventQueue.hxx>
+#include <cpp_active_objects/IEventSink.hxx>
+#include <cpp_active_objects/ObjectHandle.hxx>
+#include <cpp_active_objects/TimerService.hxx>
 #include <cpp_event_framework/Signal.hxx>
 
 namespace cpp_active_objects
@@ -25,26 +32,86 @@ namespace cpp_active_objects
 class ActiveObjectBase : public IActiveObject
 {
 public:
+    using IActiveObject::Dispatch;
+
     /**
      * @brief Assign object to a queue
      *
      * @param queue
      */
-    void SetQueue(const IEventQueue::SPtr& queue) final
+    void SetQueue(const IEventSink::SPtr& queue) final
     {
         assert(queue_ == nullptr);
         queue_ = queue;
     }
 
     /**
-     * @brief Enqueue (back) a signal to be dispatched by this object
+     * @brief Set the timer service of the domain the object is registered in
+     *
+     * @param timers
+     */
+    void SetTimerService(TimerService* timers) final
+    {
+        timers_ = timers;
+    }
+
+    /**
+     * @brief Set the handle of the object in its domain's registry
+     *
+     * @param handle
+     */
+    void SetHandle(ObjectHandle handle) final
+    {
+        handle_ = handle;
+    }
+
+    /**
+     * @brief Handle of the object, invalid unless registered with ActiveObjectDomainBase::RegisterObjectWithHandle()
+     *
+     * @return ObjectHandle
+     */
+    [[nodiscard]] ObjectHandle Handle() const
+    {
+        return handle_;
+    }
+
+    /**
+     * @brief Enqueue (back) a signal to be dispatched by this object.
+     * Objects registered with a handle enqueue the handle, others a reference to themselves.
      *
      * @param event
      */
     void Take(const cpp_event_framework::Signal::SPtr& event) final
     {
         assert(queue_ != nullptr);
-        queue_->EnqueueBack(std::static_pointer_cast<IActiveObject>(shared_from_this()), event);
+        if (handle_.IsValid())
+        {
+            queue_->EnqueueBack(handle_, event);
+        }
+        else
+        {
+            queue_->EnqueueBack(std::static_pointer_cast<IActiveObject>(shared_from_this()), event);
+        }
+    }
+
+    /**
+     * @brief Enqueue (back) a signal to be dispatched by this object, with an explicit priority instead of the
+     * signal's Priority()
+     *
+     * @param event
+     * @param priority
+     */
+    void Take(const cpp_event_framework::Signal::SPtr& event, cpp_event_framework::Signal::PriorityType priority) final
+    {
+        assert(queue_ != nullptr);
+        if (handle_.IsValid())
+        {
+            queue_->EnqueueBack(handle_, event, priority);
+        }
+        else
+        {
+            queue_->EnqueueBack(std::static_pointer_cast<IActiveObject>(shared_from_this()), event, priority);
+        }
     }
 
     /**
@@ -55,13 +122,187 @@ public:
     void TakeHighPrio(const cpp_event_framework::Signal::SPtr& event) final
     {
         assert(queue_ != nullptr);
-        queue_->EnqueueFront(std::static_pointer_cast<IActiveObject>(shared_from_this()), event);
+        if (handle_.IsValid())
+        {
+            queue_->EnqueueFront(handle_, event);
+        }
+        else
+        {
+            queue_->EnqueueFront(std::static_pointer_cast<IActiveObject>(shared_from_this()), event);
+        }
+        FrontEntryTaken();
+    }
+
+    /**
+     * @brief Enqueue (back) an intrusive reference counted event to be dispatched by this object
+     *
+     * @param event
+     */
+    void Take(const cpp_event_framework::RefCountedSignal<>::IPtr& event) final
+    {
+        assert(queue_ != nullptr);
+        if (handle_.IsValid())
+        {
+            queue_->EnqueueBack(handle_, event);
+        }
+        else
+        {
+            queue_->EnqueueBack(std::static_pointer_cast<IActiveObject>(shared_from_this()), event);
+        }
+    }
+
+    /**
+     * @brief Enqueue (front) an intrusive reference counted event to be dispatched by this object
+     *
+     * @param event
+     */
+    void TakeHighPrio(const cpp_event_framework::RefCountedSignal<>::IPtr& event) final
+    {
+        assert(queue_ != nullptr);
+        if (handle_.IsValid())
+        {
+            queue_->EnqueueFront(handle_, event);
+        }
+        else
+        {
+            queue_->EnqueueFront(std::static_pointer_cast<IActiveObject>(shared_from_this()), event);
+        }
+        FrontEntryTaken();
+    }
+
+    /**
+     * @brief Dispatch consecutive queue entries one by one, returns after an event during which the object took
+     * an event via TakeHighPrio()
+     *
+     * @param events
+     * @return size_t Number of dispatched events
+     */
+    size_t Dispatch(std::span<const cpp_event_framework::Signal::SPtr> events) override
+    {
+        EnterBatch();
+        front_taken_ = false;
+        size_t processed = 0;
+        for (const auto& event : events)
+        {
+            Dispatch(event);
+            processed++;
+            if (front_taken_)
+            {
+                break;
+            }
+        }
+        LeaveBatch();
+        return processed;
     }
 
 protected:
     ActiveObjectBase() = default;
 
+    /**
+     * @brief Mark the calling thread as dispatching a batch of events, see Dispatch(std::span)
+     */
+    void EnterBatch()
+    {
+        batch_thread_.store(std::this_thread::get_id(), std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Batch dispatching finished
+     */
+    void LeaveBatch()
+    {
+        batch_thread_.store(std::thread::id(), std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Called when the object takes an event via TakeHighPrio() while dispatching a batch, from the
+     * dispatching thread. Default: Dispatch(std::span) returns after the current event.
+     */
+    virtual void OnTakeHighPrioInBatch()
+    {
+        front_taken_ = true;
+    }
+
+    /**
+     * @brief Arm a time event to be dispatched by this object, re-arms it when it is already armed.
+     * Must be called from the domain thread, e.g. from a statemachine entry action.
+     *
+     * @param event Time event
+     * @param delay Delay
+     * @param period Re-arm period after expiry, zero: one-shot
+     */
+    void ArmTimer(const TimeEvent::SPtr& event, TimerService::Clock::duration delay,
+                  TimerService::Clock::duration period = TimerService::Clock::duration::zero())
+    {
+        assert(timers_ != nullptr);
+        if (handle_.IsValid())
+        {
+            timers_->Arm(event, handle_, delay, period);
+        }
+        else
+        {
+            timers_->Arm(event, std::static_pointer_cast<IActiveObject>(shared_from_this()), delay, period);
+        }
+    }
+
+    /**
+     * @brief Disarm a time event. Must be called from the domain thread, e.g. from a statemachine exit action.
+     *
+     * @param event Time event
+     * @return true Event was armed
+     */
+    bool DisarmTimer(TimeEvent& event)
+    {
+        assert(timers_ != nullptr);
+        return timers_->Disarm(event);
+    }
+
+    /**
+     * @brief Enqueue entries in front of all other entries of the queue, keeping their order.
+     * Entry targets are set to this object, entries is empty afterwards.
+     *
+     * @param entries
+     */
+    void TakeHighPrio(IEventSink::EntryList& entries)
+    {
+        assert(queue_ != nullptr);
+        if (entries.empty())
+        {
+            return;
+        }
+
+        if (handle_.IsValid())
+        {
+            for (auto& entry : entries)
+            {
+                entry.handle = handle_;
+            }
+        }
+        else
+        {
+            const auto self = std::static_pointer_cast<IActiveObject>(shared_from_this());
+            for (auto& entry : entries)
+            {
+                entry.target = self;
+            }
+        }
+        queue_->SpliceFront(entries);
+    }
+
 private:
-    IEventQueue::SPtr queue_;
+    IEventSink::SPtr queue_;
+    TimerService* timers_ = nullptr;
+    ObjectHandle handle_;
+    // Thread running Dispatch(std::span), TakeHighPrio() of other threads is not ordered with the batch anyway
+    std::atomic<std::thread::id> batch_thread_;
+    bool front_taken_ = false;
+
+    void FrontEntryTaken()
+    {
+        if (batch_thread_.load(std::memory_order_relaxed) == std::this_thread::get_id())
+        {
+            OnTakeHighPrioInBatch();
+        }
+    }
 };
 } // namespace cpp_active_objects
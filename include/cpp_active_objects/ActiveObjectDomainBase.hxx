@@ -10,10 +10,19 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
 #include <memory>
+#include <optional>
+#include <span>
 
 #include <cpp_active_objects/IActiveObjectDomain.hxx>
 #include <cpp_active_objects/IEventQueue.hxx>
+#include <cpp_active_objects/ObjectHandle.hxx>
+#include <cpp_active_objects/ObjectRegistry.hxx>
+#include <cpp_active_objects/TimerService.hxx>
 #include <cpp_event_framework/Signal.hxx>
 
 namespace cpp_active_objects
@@ -31,6 +40,11 @@ public:
      */
     using SPtr = std::shared_ptr<ActiveObjectDomainBase>;
 
+    /**
+     * @brief Max. number of entries dequeued at once by Run()
+     */
+    static constexpr size_t kDequeueBatchSize = 16;
+
     /**
      * @brief Assign an active object to this domain
      *
@@ -38,33 +52,128 @@ public:
      */
     void RegisterObject(const IActiveObject::SPtr& active_object) final
     {
-        active_object->SetQueue(queue_);
+        active_object->SetQueue(ObjectQueue(active_object));
+        active_object->SetTimerService(ObjectTimerService());
+    }
+
+    /**
+     * @brief Assign an active object to this domain and address it by handle: the domain keeps a reference to
+     * the object until it is deregistered, queue entries carry the handle instead of a reference.
+     * Take() does no reference counting then. Domains without registry (see ThreadPoolActiveObjectDomain) or with
+     * a queue that does not support handles (IEventSink::SupportsHandles()) register the object by reference instead.
+     *
+     * @param active_object
+     * @return ObjectHandle Invalid if the object was registered by reference
+     */
+    ObjectHandle RegisterObjectWithHandle(const IActiveObject::SPtr& active_object)
+    {
+        auto* handles = ObjectHandles();
+        if ((handles == nullptr) || ((queue_ != nullptr) && !queue_->SupportsHandles()))
+        {
+            RegisterObject(active_object);
+            return ObjectHandle();
+        }
+        const auto handle = handles->Add(active_object);
+        assert(handle.IsValid());
+
+        active_object->SetHandle(handle);
+        RegisterObject(active_object);
+        return handle;
+    }
+
+    /**
+     * @brief Deregister an object registered with a handle. Events enqueued before are still dispatched
+     * (PriorityEventQueue: only those of the highest level), events taken afterwards are dropped.
+     * The domain releases its reference to the object in the domain thread.
+     *
+     * @param handle
+     */
+    void DeregisterObject(ObjectHandle handle)
+    {
+        // Objects registered by reference have an invalid handle, see RegisterObjectWithHandle()
+        if ((queue_ != nullptr) && handle.IsValid())
+        {
+            queue_->EnqueueBack(handle, cpp_event_framework::Signal::SPtr());
+        }
     }
 
 protected:
     /**
      * @brief Constructor
      *
-     * @param queue Queue to use
+     * @param queue Queue to use, nullptr for domains that do not use Run(), Stop() and object handles
      */
     explicit ActiveObjectDomainBase(IEventQueue::SPtr queue) : queue_(std::move(queue))
     {
     }
 
     /**
-     * @brief Dequeue and dispatch event queue entries
+     * @brief Get queue to assign to an active object that is registered in this domain.
+     * Default: all objects share the domain queue.
+     *
+     * @param active_object
+     * @return IEventSink::SPtr
+     */
+    virtual IEventSink::SPtr ObjectQueue(const IActiveObject::SPtr& /*active_object*/)
+    {
+        return queue_;
+    }
+
+    /**
+     * @brief Get timer service to assign to an active object that is registered in this domain.
+     * Default: the domain's timer service, serviced by Run().
+     *
+     * @return TimerService*
+     */
+    virtual TimerService* ObjectTimerService()
+    {
+        return &timers_;
+    }
+
+    /**
+     * @brief Get registry of objects registered with a handle.
+     * Default: the domain's registry, resolved by Run().
+     *
+     * @return ObjectRegistry*
+     */
+    virtual ObjectRegistry* ObjectHandles()
+    {
+        return &handles_;
+    }
+
+    /**
+     * @brief Dequeue and dispatch event queue entries in batches of up to kDequeueBatchSize entries,
+     * dispatch expired time events. Consecutive entries of a batch for the same target are passed to
+     * IActiveObject::Dispatch(std::span) in one call.
      *
      */
     void Run()
     {
+        assert(queue_ != nullptr);
+        std::array<IEventQueue::QueueEntry, kDequeueBatchSize> batch;
         while (true)
         {
-            const auto entry = queue_->Dequeue();
-            if (entry.target == nullptr)
+            timers_.Process();
+
+            // Zero entries: timeout - time event(s) due
+            const auto count = queue_->DequeueBatch(batch, timers_.NextExpiry());
+            size_t i = 0;
+            while (i < count)
             {
-                return;
+                const auto processed = DispatchEntries(std::span(batch).subspan(i, count - i));
+                if (processed == 0)
+                {
+                    return;
+                }
+                i += processed;
+
+                // Entries enqueued at the front while dispatching go before the remaining entries of the batch
+                // and before time events that expire meanwhile
+                if (!DispatchFrontEntries())
+                {
+                    return;
+                }
             }
-            entry.target->Dispatch(entry.event);
         }
     }
 
@@ -74,10 +183,128 @@ protected:
      */
     void Stop()
     {
-        queue_->EnqueueBack(nullptr, nullptr);
+        assert(queue_ != nullptr);
+        queue_->EnqueueBack(nullptr, cpp_event_framework::Signal::SPtr());
     }
 
 private:
     IEventQueue::SPtr queue_;
+    ObjectRegistry handles_;
+    TimerService timers_{&handles_};
+    // Events of a group of entries being dispatched, see DispatchEntries()
+    std::array<cpp_event_framework::Signal::SPtr, kDequeueBatchSize> group_events_;
+
+    bool DispatchFrontEntries()
+    {
+        while (auto entry = queue_->TryDequeueFront())
+        {
+            if (!DispatchEntry(*entry))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Dispatch the first entry together with the following entries for the same target, returns the number of
+    // dispatched entries (0: dummy entry that exits Run()). Undispatched entries are left in place.
+    size_t DispatchEntries(std::span<IEventQueue::QueueEntry> entries)
+    {
+        const auto size = GroupSize(entries);
+        if (size == 1)
+        {
+            const auto entry = std::move(entries.front());
+            return DispatchEntry(entry) ? 1 : 0;
+        }
+
+        // Stale handle: object has been deregistered, drop events
+        auto* target = (entries.front().target != nullptr) ? entries.front().target.get()
+                                                           : handles_.Resolve(entries.front().handle);
+        size_t processed = size;
+        if (target != nullptr)
+        {
+            for (size_t i = 0; i < size; i++)
+            {
+                group_events_.at(i) = std::move(entries[i].event);
+            }
+            processed =
+                target->Dispatch(std::span<const cpp_event_framework::Signal::SPtr>(group_events_.data(), size));
+            assert(processed > 0);
+            for (size_t i = processed; i < size; i++)
+            {
+                entries[i].event = std::move(group_events_.at(i));
+            }
+            std::ranges::fill(group_events_, nullptr);
+        }
+        for (size_t i = 0; i < processed; i++)
+        {
+            entries[i] = IEventQueue::QueueEntry();
+        }
+        return processed;
+    }
+
+    // Number of consecutive std::shared_ptr event entries for the same target, intrusive events and control
+    // entries are dispatched one by one
+    static size_t GroupSize(std::span<const IEventQueue::QueueEntry> entries)
+    {
+        const auto& first = entries.front();
+        if (first.event == nullptr)
+        {
+            return 1;
+        }
+
+        size_t size = 1;
+        while ((size < entries.size()) && (entries[size].event != nullptr) && (entries[size].target == first.target) &&
+               (entries[size].handle == first.handle))
+        {
+            size++;
+        }
+        return size;
+    }
+
+    // Returns false for the dummy entry that exits Run()
+    bool DispatchEntry(const IEventQueue::QueueEntry& entry)
+    {
+        if (entry.handle.IsValid())
+        {
+            DispatchHandle(entry);
+            return true;
+        }
+        if (entry.target == nullptr)
+        {
+            return false;
+        }
+        DispatchTo(*entry.target, entry);
+        return true;
+    }
+
+    void DispatchHandle(const IEventQueue::QueueEntry& entry)
+    {
+        // No event: deregistration, see DeregisterObject()
+        if ((entry.event == nullptr) && (entry.intrusive_event == nullptr))
+        {
+            handles_.Remove(entry.handle);
+            return;
+        }
+
+        // Stale handle: object has been deregistered, drop event
+        auto* target = handles_.Resolve(entry.handle);
+        if (target != nullptr)
+        {
+            DispatchTo(*target, entry);
+        }
+    }
+
+    static void DispatchTo(IActiveObject& target, const IEventQueue::QueueEntry& entry)
+    {
+        if (entry.intrusive_event != nullptr)
+        {
+            target.Dispatch(entry.intrusive_event);
+        }
+        else
+        {
+            target.Dispatch(entry.event);
+        }
+    }
 };
 } // namespace cpp_active_objects
@@ -10,8 +10,9 @@
 
 #pragma once
 
+#include <algorithm>
 #include <memory>
-#include <ranges>
+#include <span>
 #include <vector>
 
 #include <cpp_active_objects/ActiveObjectBase.hxx>
@@ -22,7 +23,9 @@ namespace cpp_active_objects
 {
 /**
  * @brief Base class for a statemachine using active-object pattern
- * Supports deferred events.
+ * Supports deferred events. Deferred events are stored per deferring state, in deferral order.
+ * Recalling moves a whole group to the front of the object's queue in one operation (queues overriding
+ * IEventSink::SpliceFront() take over the list nodes).
  *
  * @tparam Fsm Statemachine to aggregate
  */
@@ -38,7 +41,7 @@ public:
 
     Hsm()
     {
-        fsm_.on_defer_event_ = [this](Fsm::StateRef, Fsm::Event event) { DeferEvent(event); };
+        fsm_.on_defer_event_ = [this](Fsm::StateRef state, Fsm::Event event) { DeferEvent(state, event); };
         fsm_.on_recall_deferred_events_ = [this](Fsm::StateRef) { RecallEvents(); };
     }
 
@@ -52,6 +55,22 @@ public:
         fsm_.React(event);
     }
 
+    /**
+     * @brief Dispatch consecutive queue entries in active object domain.
+     * Returns after an event that recalled deferred events or took an event via TakeHighPrio(), the caller
+     * processes these before the remaining ones. Statemachine hooks still fire per event.
+     *
+     * @param events
+     * @return size_t Number of dispatched events
+     */
+    size_t Dispatch(std::span<const cpp_event_framework::Signal::SPtr> events) override
+    {
+        EnterBatch();
+        const auto processed = fsm_.React(events);
+        LeaveBatch();
+        return processed;
+    }
+
 protected:
     /**
      * @brief Statemachine
@@ -59,21 +78,72 @@ protected:
      */
     Fsm fsm_;
 
+    /**
+     * @brief Events taken via TakeHighPrio() while dispatching a batch go before its remaining events
+     */
+    void OnTakeHighPrioInBatch() override
+    {
+        fsm_.StopReact();
+    }
+
+    /**
+     * @brief Recall only the events deferred by one state. fsm_.RecallEvents() recalls the events of all states,
+     * group by group in the order the groups were created.
+     *
+     * @param state Deferring state
+     */
+    void RecallEvents(Fsm::StateRef state)
+    {
+        recall_state_ = &state;
+        fsm_.RecallEvents();
+        recall_state_ = nullptr;
+    }
+
+    /**
+     * @brief Number of events deferred by a state
+     *
+     * @param state Deferring state
+     * @return size_t
+     */
+    [[nodiscard]] size_t NumDeferredEvents(Fsm::StateRef state) const
+    {
+        const auto group = std::ranges::find(deferred_groups_, &state, &DeferredGroup::state);
+        return (group != deferred_groups_.end()) ? group->events.size() : 0;
+    }
+
 private:
-    std::vector<cpp_event_framework::Signal::SPtr> deferred_events_;
+    struct DeferredGroup
+    {
+        Fsm::StatePtr state;
+        // Stored as queue entries without target (no reference cycle), so recalling is a list splice
+        IEventSink::EntryList events;
+    };
 
-    void DeferEvent(Fsm::Event event)
+    // One group per state that ever deferred an event, groups are kept for reuse
+    std::vector<DeferredGroup> deferred_groups_;
+    IEventSink::EntryList recalled_events_;
+    Fsm::StatePtr recall_state_ = nullptr;
+
+    void DeferEvent(Fsm::StateRef state, Fsm::Event event)
     {
-        deferred_events_.emplace_back(event);
+        auto group = std::ranges::find(deferred_groups_, &state, &DeferredGroup::state);
+        if (group == deferred_groups_.end())
+        {
+            group = deferred_groups_.insert(deferred_groups_.end(), DeferredGroup{&state, {}});
+        }
+        group->events.emplace_back(nullptr, event);
     }
 
     void RecallEvents()
     {
-        for (const auto& event : std::ranges::reverse_view(deferred_events_))
+        for (auto& group : deferred_groups_)
         {
-            TakeHighPrio(event);
+            if ((recall_state_ == nullptr) || (group.state == recall_state_))
+            {
+                recalled_events_.splice(recalled_events_.end(), group.events);
+            }
         }
-        deferred_events_.clear();
+        TakeHighPrio(recalled_events_);
     }
 };
 } // namespace cpp_active_objects
@@ -10,14 +10,18 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
+#include <span>
 
 #include <cpp_active_objects/IEventTarget.hxx>
+#include <cpp_active_objects/ObjectHandle.hxx>
 #include <cpp_event_framework/Signal.hxx>
 
 namespace cpp_active_objects
 {
-class IEventQueue;
+class IEventSink;
+class TimerService;
 
 /**
  * @brief Interface of an active object
@@ -38,9 +42,30 @@ public:
     /**
      * @brief Set the Queue object
      *
-     * @param queue
+     * @param queue Enqueue side of the queue the object takes events into
      */
-    virtual void SetQueue(const std::shared_ptr<IEventQueue>& queue) = 0;
+    virtual void SetQueue(const std::shared_ptr<IEventSink>& queue) = 0;
+
+    /**
+     * @brief Set the timer service of the domain the object is registered in.
+     * Default: ignore, for objects that do not use time events.
+     *
+     * @param timers Timer service, nullptr if the domain has none
+     */
+    virtual void SetTimerService(TimerService* /*timers*/)
+    {
+    }
+
+    /**
+     * @brief Set the handle of the object in its domain's registry, see
+     * ActiveObjectDomainBase::RegisterObjectWithHandle().
+     * Default: ignore, the object keeps taking events by reference.
+     *
+     * @param handle
+     */
+    virtual void SetHandle(ObjectHandle /*handle*/)
+    {
+    }
 
     /**
      * @brief Dispatch event in active object domain
@@ -48,5 +73,35 @@ public:
      * @param event
      */
     virtual void Dispatch(const cpp_event_framework::Signal::SPtr& event) = 0;
+
+    /**
+     * @brief Dispatch intrusive reference counted event in active object domain.
+     * Default: forward to Dispatch(const Signal::SPtr&). The std::shared_ptr holds an intrusive reference, but its
+     * control block is allocated on the heap - objects taking intrusive events frequently should override this.
+     *
+     * @param event
+     */
+    virtual void Dispatch(const cpp_event_framework::RefCountedSignal<>::IPtr& event)
+    {
+        Dispatch(cpp_event_framework::RefCountedSignal<>::SharedFromIntrusive(event));
+    }
+
+    /**
+     * @brief Dispatch consecutive queue entries for this object in one call.
+     * Events taken via TakeHighPrio() during the call must be processed before the remaining events: the object
+     * returns after the event that took them, the caller dispatches the entries at the front of the queue and
+     * passes the remaining events again. Default: dispatch all one by one, see ActiveObjectBase.
+     *
+     * @param events
+     * @return size_t Number of dispatched events, at least one
+     */
+    virtual size_t Dispatch(std::span<const cpp_event_framework::Signal::SPtr> events)
+    {
+        for (const auto& event : events)
+        {
+            Dispatch(event);
+        }
+        return events.size();
+    }
 };
 } // namespace cpp_active_objects
@@ -10,19 +10,23 @@
 
 #pragma once
 
+#include <cassert>
+#include <chrono>
+#include <cstddef>
 #include <memory>
+#include <optional>
+#include <span>
 
+#include <cpp_active_objects/IEventSink.hxx>
 #include <cpp_event_framework/Signal.hxx>
 
 namespace cpp_active_objects
 {
-class IActiveObject;
-
 /**
  * @brief Event queue interface
  *
  */
-class IEventQueue
+class IEventQueue : public IEventSink
 {
 public:
     /**
@@ -32,47 +36,62 @@ public:
     using SPtr = std::shared_ptr<IEventQueue>;
 
     /**
-     * @brief Type of queue entrie
+     * @brief Destroy the EventQueue
+     *
      */
-    struct QueueEntry
-    {
-        /**
-         * @brief Dispatch target
-         */
-        std::shared_ptr<IActiveObject> target;
-        /**
-         * @brief Event
-         */
-        cpp_event_framework::Signal::SPtr event;
-    };
+    ~IEventQueue() override = default;
 
     /**
-     * @brief Destroy the EventQueue
+     * @brief Dequeue an ActiveObject-Event pair
      *
+     * @return std::pair<std::shared_ptr<IActiveObject>, Signal::SPtr>
      */
-    virtual ~IEventQueue() = default;
+    virtual QueueEntry Dequeue() = 0;
 
     /**
-     * @brief Enqueue an event to be dispatched by a target
+     * @brief Dequeue an entry, blocking until there is an entry in the queue or the deadline has passed.
+     * Default: blocks like Dequeue() - queues that cannot wait with a deadline delay timers until the next entry.
      *
-     * @param target
-     * @param event
+     * @param deadline
+     * @return std::optional<QueueEntry> Queue entry, empty on timeout
      */
-    virtual void EnqueueBack(std::shared_ptr<IActiveObject> target, cpp_event_framework::Signal::SPtr event) = 0;
+    virtual std::optional<QueueEntry> DequeueUntil(std::chrono::steady_clock::time_point /*deadline*/)
+    {
+        return Dequeue();
+    }
 
     /**
-     * @brief Enqueue an event to be dispatched by a target
+     * @brief Dequeue up to entries.size() entries, blocking until there is at least one entry in the queue or the
+     * deadline has passed. Entries enqueued at the front while the batch is being dispatched are returned by
+     * TryDequeueFront(), the consumer must dispatch them before the remaining batch entries.
+     * Default: dequeues one entry via Dequeue() / DequeueUntil().
      *
-     * @param target
-     * @param event
+     * @param entries Buffer, must not be empty
+     * @param deadline time_point::max(): no timeout
+     * @return size_t Number of dequeued entries, 0 on timeout
      */
-    virtual void EnqueueFront(std::shared_ptr<IActiveObject> target, cpp_event_framework::Signal::SPtr event) = 0;
+    virtual size_t DequeueBatch(std::span<QueueEntry> entries, std::chrono::steady_clock::time_point deadline)
+    {
+        assert(!entries.empty());
+        auto entry = (deadline == std::chrono::steady_clock::time_point::max()) ? std::optional(Dequeue())
+                                                                                  : DequeueUntil(deadline);
+        if (!entry.has_value())
+        {
+            return 0;
+        }
+        entries.front() = std::move(*entry);
+        return 1;
+    }
 
     /**
-     * @brief Dequeue an ActiveObject-Event pair
+     * @brief Dequeue an entry enqueued at the front since the last DequeueBatch(), never blocks.
+     * Default: none - the default DequeueBatch() only returns single entries.
      *
-     * @return std::pair<std::shared_ptr<IActiveObject>, Signal::SPtr>
+     * @return std::optional<QueueEntry> Queue entry, empty if there is none
      */
-    virtual QueueEntry Dequeue() = 0;
+    virtual std::optional<QueueEntry> TryDequeueFront()
+    {
+        return std::nullopt;
+    }
 };
 } // namespace cpp_active_objects
@@ -0,0 +1,237 @@
+/**
+ * @file IEventSink.hxx
+ * @author Dirk Ziegelmeier (dirk@ziegelmeier.net)
+ * @brief
+ * @date 16-10-2026
+ *
+ * @copyright SPDX-License-Identifier: Apache-2.0
+ *
+ */
+
+#pragma once
+
+#include <cassert>
+#include <list>
+#include <memory>
+#include <ranges>
+
+#include <cpp_active_objects/ObjectHandle.hxx>
+#include <cpp_event_framework/Signal.hxx>
+
+namespace cpp_active_objects
+{
+class IActiveObject;
+
+/**
+ * @brief Enqueue side of an event queue: what active objects need to take events.
+ * Event queues (IEventQueue) add the dequeue side used by the domain that runs them.
+ *
+ */
+class IEventSink
+{
+public:
+    /**
+     * @brief Shared pointer alias
+     *
+     */
+    using SPtr = std::shared_ptr<IEventSink>;
+
+    /**
+     * @brief Type of queue entrie
+     */
+    struct QueueEntry
+    {
+        /**
+         * @brief Dispatch target
+         */
+        std::shared_ptr<IActiveObject> target;
+        /**
+         * @brief Event
+         */
+        cpp_event_framework::Signal::SPtr event;
+        /**
+         * @brief Dispatch target registered with a handle, valid instead of target
+         */
+        ObjectHandle handle;
+        /**
+         * @brief Intrusive reference counted event, set instead of event (no shared_ptr control block)
+         */
+        cpp_event_framework::RefCountedSignal<>::IPtr intrusive_event = nullptr;
+    };
+
+    /**
+     * @brief List of queue entries, see SpliceFront()
+     */
+    using EntryList = std::list<QueueEntry>;
+
+    /**
+     * @brief Destroy the EventSink
+     *
+     */
+    virtual ~IEventSink() = default;
+
+    /**
+     * @brief Enqueue an event to be dispatched by a target
+     *
+     * @param target
+     * @param event
+     */
+    virtual void EnqueueBack(std::shared_ptr<IActiveObject> target, cpp_event_framework::Signal::SPtr event) = 0;
+
+    /**
+     * @brief Enqueue an event to be dispatched by a target
+     *
+     * @param target
+     * @param event
+     */
+    virtual void EnqueueFront(std::shared_ptr<IActiveObject> target, cpp_event_framework::Signal::SPtr event) = 0;
+
+    /**
+     * @brief Whether the handle overloads of EnqueueBack() / EnqueueFront() are implemented.
+     * Default: no - ActiveObjectDomainBase::RegisterObjectWithHandle() registers objects by reference then,
+     * so the handle overloads are never called.
+     *
+     * @return bool
+     */
+    [[nodiscard]] virtual bool SupportsHandles() const
+    {
+        return false;
+    }
+
+    /**
+     * @brief Enqueue an event to be dispatched by a target registered with a handle.
+     * Default: not supported, see SupportsHandles().
+     *
+     * @param target
+     * @param event
+     */
+    virtual void EnqueueBack(ObjectHandle /*target*/, cpp_event_framework::Signal::SPtr /*event*/)
+    {
+        assert(false);
+    }
+
+    /**
+     * @brief Enqueue an event to be dispatched by a target registered with a handle.
+     * Default: not supported, see SupportsHandles().
+     *
+     * @param target
+     * @param event
+     */
+    virtual void EnqueueFront(ObjectHandle /*target*/, cpp_event_framework::Signal::SPtr /*event*/)
+    {
+        assert(false);
+    }
+
+    /**
+     * @brief Enqueue an intrusive event to be dispatched by a target.
+     * Default: enqueue it as Signal::SPtr (see RefCountedSignal::SharedFromIntrusive()).
+     *
+     * @param target
+     * @param event
+     */
+    virtual void EnqueueBack(std::shared_ptr<IActiveObject> target,
+                             cpp_event_framework::RefCountedSignal<>::IPtr event)
+    {
+        EnqueueBack(std::move(target), cpp_event_framework::RefCountedSignal<>::SharedFromIntrusive(event));
+    }
+
+    /**
+     * @brief Enqueue an intrusive event to be dispatched by a target.
+     * Default: enqueue it as Signal::SPtr (see RefCountedSignal::SharedFromIntrusive()).
+     *
+     * @param target
+     * @param event
+     */
+    virtual void EnqueueFront(std::shared_ptr<IActiveObject> target,
+                              cpp_event_framework::RefCountedSignal<>::IPtr event)
+    {
+        EnqueueFront(std::move(target), cpp_event_framework::RefCountedSignal<>::SharedFromIntrusive(event));
+    }
+
+    /**
+     * @brief Enqueue an intrusive event to be dispatched by a target registered with a handle.
+     * Default: enqueue it as Signal::SPtr (see RefCountedSignal::SharedFromIntrusive()).
+     *
+     * @param target
+     * @param event
+     */
+    virtual void EnqueueBack(ObjectHandle target, cpp_event_framework::RefCountedSignal<>::IPtr event)
+    {
+        EnqueueBack(target, cpp_event_framework::RefCountedSignal<>::SharedFromIntrusive(event));
+    }
+
+    /**
+     * @brief Enqueue an intrusive event to be dispatched by a target registered with a handle.
+     * Default: enqueue it as Signal::SPtr (see RefCountedSignal::SharedFromIntrusive()).
+     *
+     * @param target
+     * @param event
+     */
+    virtual void EnqueueFront(ObjectHandle target, cpp_event_framework::RefCountedSignal<>::IPtr event)
+    {
+        EnqueueFront(target, cpp_event_framework::RefCountedSignal<>::SharedFromIntrusive(event));
+    }
+
+    /**
+     * @brief Enqueue an event with an explicit priority instead of the signal's Priority().
+     * Default: queues without priority levels ignore the priority.
+     *
+     * @param target
+     * @param event
+     * @param priority
+     */
+    virtual void EnqueueBack(std::shared_ptr<IActiveObject> target, cpp_event_framework::Signal::SPtr event,
+                             cpp_event_framework::Signal::PriorityType /*priority*/)
+    {
+        EnqueueBack(std::move(target), std::move(event));
+    }
+
+    /**
+     * @brief Enqueue an event for a target registered with a handle with an explicit priority.
+     * Default: queues without priority levels ignore the priority.
+     *
+     * @param target
+     * @param event
+     * @param priority
+     */
+    virtual void EnqueueBack(ObjectHandle target, cpp_event_framework::Signal::SPtr event,
+                             cpp_event_framework::Signal::PriorityType /*priority*/)
+    {
+        EnqueueBack(target, std::move(event));
+    }
+
+    /**
+     * @brief Enqueue entries in front of all other entries, keeping their order (first entry is dequeued first).
+     * entries is empty afterwards. The default implementation calls EnqueueFront() per entry, list based queues
+     * move the list nodes over under one lock without allocating.
+     *
+     * @param entries
+     */
+    virtual void SpliceFront(EntryList& entries)
+    {
+        for (auto& entry : std::ranges::reverse_view(entries))
+        {
+            if (entry.intrusive_event != nullptr)
+            {
+                if (entry.handle.IsValid())
+                {
+                    EnqueueFront(entry.handle, std::move(entry.intrusive_event));
+                }
+                else
+                {
+                    EnqueueFront(std::move(entry.target), std::move(entry.intrusive_event));
+                }
+            }
+            else if (entry.handle.IsValid())
+            {
+                EnqueueFront(entry.handle, std::move(entry.event));
+            }
+            else
+            {
+                EnqueueFront(std::move(entry.target), std::move(entry.event));
+            }
+        }
+        entries.clear();
+    }
+};
+} // namespace cpp_active_objects
@@ -40,10 +40,46 @@ public:
     virtual void Take(const cpp_event_framework::Signal::SPtr& event) = 0;
 
     /**
-     * @brief Take an event from ANY thread, enqueue FRONT
+     * @brief Take an event from ANY thread with an explicit priority instead of the signal's Priority(),
+     * enqueue BACK of the priority level (queues without priority levels: enqueue BACK).
+     * Default: ignore the priority.
+     *
+     * @param event
+     * @param priority
+     */
+    virtual void Take(const cpp_event_framework::Signal::SPtr& event,
+                      cpp_event_framework::Signal::PriorityType /*priority*/)
+    {
+        Take(event);
+    }
+
+    /**
+     * @brief Take an event from ANY thread, enqueue FRONT (SpscEventQueue: domain thread only)
      *
      * @param event
      */
     virtual void TakeHighPrio(const cpp_event_framework::Signal::SPtr& event) = 0;
+
+    /**
+     * @brief Take an intrusive reference counted event from ANY thread, enqueue BACK.
+     * Default: take it as Signal::SPtr (see RefCountedSignal::SharedFromIntrusive()).
+     *
+     * @param event
+     */
+    virtual void Take(const cpp_event_framework::RefCountedSignal<>::IPtr& event)
+    {
+        Take(cpp_event_framework::RefCountedSignal<>::SharedFromIntrusive(event));
+    }
+
+    /**
+     * @brief Take an intrusive reference counted event from ANY thread, enqueue FRONT (SpscEventQueue: domain
+     * thread only). Default: take it as Signal::SPtr (see RefCountedSignal::SharedFromIntrusive()).
+     *
+     * @param event
+     */
+    virtual void TakeHighPrio(const cpp_event_framework::RefCountedSignal<>::IPtr& event)
+    {
+        TakeHighPrio(cpp_event_framework::RefCountedSignal<>::SharedFromIntrusive(event));
+    }
 };
 } // namespace cpp_active_objects
@@ -0,0 +1,342 @@
+/**
+ * @file IntrusiveEventQueue.hxx
+ * @author Dirk Ziegelmeier (dirk@ziegelmeier.net)
+ * @brief
+ * @date 16-10-2026
+ *
+ * @copyright SPDX-License-Identifier: Apache-2.0
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <optional>
+#include <semaphore>
+
+#include <cpp_active_objects/IActiveObject.hxx>
+#include <cpp_active_objects/IEventQueue.hxx>
+#include <cpp_event_framework/Concepts.hxx>
+#include <cpp_event_framework/Signal.hxx>
+
+namespace cpp_active_objects
+{
+template <cpp_event_framework::Semaphore SemaphoreType, cpp_event_framework::Mutex MutexType>
+class IntrusiveEventQueue;
+
+/**
+ * @brief Link of an IntrusiveEventQueue
+ */
+struct QueueLink
+{
+    /**
+     * @brief Next link in queue
+     */
+    QueueLink* next = nullptr;
+    /**
+     * @brief Queue entry
+     */
+    IEventQueue::QueueEntry entry;
+};
+
+/**
+ * @brief Base class for signals that carry their own queue link. Use it as signal base class, e.g.
+ * class MyEvent : public cpp_event_framework::SignalBase<MyEvent, kId, cpp_active_objects::LinkableSignal>
+ * IntrusiveEventQueue links such signals in without allocating. A signal can only be linked into one queue
+ * position at a time - when it is taken by several targets (multicast) before being dispatched, the additional
+ * entries use an allocated link.
+ */
+class LinkableSignal : public cpp_event_framework::Signal
+{
+protected:
+    /**
+     * @brief Constructor
+     *
+     * @param signal_id Signal ID
+     */
+    explicit LinkableSignal(IdType signal_id) : Signal(signal_id, true)
+    {
+    }
+
+private:
+    template <cpp_event_framework::Semaphore SemaphoreType, cpp_event_framework::Mutex MutexType>
+    friend class IntrusiveEventQueue;
+
+    QueueLink link_;
+    std::atomic_flag linked_;
+};
+
+/**
+ * @brief Event queue that links LinkableSignal events in via their embedded link: no allocation per entry.
+ * Other signals, and LinkableSignals whose link is in use (multicast), get a link allocated from a memory resource.
+ *
+ * @tparam SemaphoreType Sempahore type to use - e.g. to be able to supply own RT-capable implementation
+ *         NamedRequirements: DefaultConstructible. No named requirements for release() and acquire() available.
+ * @tparam MutexType Mutex type to use - e.g. to be able to supply own RT-capable implementation
+ *         NamedRequirements: DefaultConstructible, Destructible, BasicLockable
+ */
+template <cpp_event_framework::Semaphore SemaphoreType = std::counting_semaphore<>,
+          cpp_event_framework::Mutex MutexType = std::mutex>
+class IntrusiveEventQueue final : public IEventQueue
+{
+public:
+    /**
+     * @brief Constructor
+     *
+     * @param fallback Memory resource for links of non-linkable or multicast signals
+     */
+    explicit IntrusiveEventQueue(std::pmr::memory_resource* fallback = std::pmr::new_delete_resource())
+        : fallback_(fallback)
+    {
+    }
+
+    ~IntrusiveEventQueue() override
+    {
+        while (head_ != nullptr)
+        {
+            auto* link = head_;
+            head_ = link->next;
+            Release(link);
+        }
+    }
+
+    // Non-copyable, non-movable
+    IntrusiveEventQueue(const IntrusiveEventQueue& rhs) = delete;
+    IntrusiveEventQueue(IntrusiveEventQueue&& rhs) = delete;
+    IntrusiveEventQueue& operator=(const IntrusiveEventQueue& rhs) = delete;
+    IntrusiveEventQueue& operator=(IntrusiveEventQueue&& rhs) = delete;
+
+    /**
+     * @brief Enqueue an event to be dispatched by a target
+     *
+     * @param target
+     * @param event
+     */
+    void EnqueueBack(IActiveObject::SPtr target, cpp_event_framework::Signal::SPtr event) override
+    {
+        PushBack(Claim(QueueEntry{std::move(target), std::move(event), {}}));
+    }
+
+    /**
+     * @brief Enqueue an event to be dispatched by a target
+     *
+     * @param target
+     * @param event
+     */
+    void EnqueueFront(IActiveObject::SPtr target, cpp_event_framework::Signal::SPtr event) override
+    {
+        PushFront(Claim(QueueEntry{std::move(target), std::move(event), {}}));
+    }
+
+    /**
+     * @brief Handle overloads are implemented
+     *
+     * @return bool true
+     */
+    [[nodiscard]] bool SupportsHandles() const override
+    {
+        return true;
+    }
+
+    /**
+     * @brief Enqueue an event to be dispatched by a target registered with a handle
+     *
+     * @param target
+     * @param event
+     */
+    void EnqueueBack(ObjectHandle target, cpp_event_framework::Signal::SPtr event) override
+    {
+        PushBack(Claim(QueueEntry{nullptr, std::move(event), target}));
+    }
+
+    /**
+     * @brief Enqueue an event to be dispatched by a target registered with a handle
+     *
+     * @param target
+     * @param event
+     */
+    void EnqueueFront(ObjectHandle target, cpp_event_framework::Signal::SPtr event) override
+    {
+        PushFront(Claim(QueueEntry{nullptr, std::move(event), target}));
+    }
+
+    /**
+     * @brief Enqueue an intrusive event to be dispatched by a target
+     *
+     * @param target
+     * @param event
+     */
+    void EnqueueBack(IActiveObject::SPtr target, cpp_event_framework::RefCountedSignal<>::IPtr event) override
+    {
+        PushBack(Claim(QueueEntry{std::move(target), nullptr, {}, std::move(event)}));
+    }
+
+    /**
+     * @brief Enqueue an intrusive event to be dispatched by a target
+     *
+     * @param target
+     * @param event
+     */
+    void EnqueueFront(IActiveObject::SPtr target, cpp_event_framework::RefCountedSignal<>::IPtr event) override
+    {
+        PushFront(Claim(QueueEntry{std::move(target), nullptr, {}, std::move(event)}));
+    }
+
+    /**
+     * @brief Enqueue an intrusive event to be dispatched by a target registered with a handle
+     *
+     * @param target
+     * @param event
+     */
+    void EnqueueBack(ObjectHandle target, cpp_event_framework::RefCountedSignal<>::IPtr event) override
+    {
+        PushBack(Claim(QueueEntry{nullptr, nullptr, target, std::move(event)}));
+    }
+
+    /**
+     * @brief Enqueue an intrusive event to be dispatched by a target registered with a handle
+     *
+     * @param target
+     * @param event
+     */
+    void EnqueueFront(ObjectHandle target, cpp_event_framework::RefCountedSignal<>::IPtr event) override
+    {
+        PushFront(Claim(QueueEntry{nullptr, nullptr, target, std::move(event)}));
+    }
+
+    /**
+     * @brief Dequeue an entry, possibly blocking until there is an entry in the queue
+     *
+     * @return QueueEntry Queue entry
+     */
+    QueueEntry Dequeue() override
+    {
+        sem_.acquire();
+        return PopFront();
+    }
+
+    /**
+     * @brief Dequeue an entry, blocking until there is an entry in the queue or the deadline has passed
+     * (SemaphoreType without try_acquire_until(): same as Dequeue())
+     *
+     * @param deadline
+     * @return std::optional<QueueEntry> Queue entry, empty on timeout
+     */
+    std::optional<QueueEntry> DequeueUntil(std::chrono::steady_clock::time_point deadline) override
+    {
+        if constexpr (cpp_event_framework::TimedSemaphore<SemaphoreType>)
+        {
+            if (!sem_.try_acquire_until(deadline))
+            {
+                return std::nullopt;
+            }
+        }
+        else
+        {
+            sem_.acquire();
+        }
+        return PopFront();
+    }
+
+private:
+    std::pmr::polymorphic_allocator<QueueLink> fallback_;
+    QueueLink* head_ = nullptr;
+    QueueLink* tail_ = nullptr;
+    SemaphoreType sem_{0};
+    MutexType mutex_;
+
+    static LinkableSignal* AsLinkable(const cpp_event_framework::Signal::SPtr& event)
+    {
+        return ((event != nullptr) && event->IsLinkable()) ? static_cast<LinkableSignal*>(event.get()) : nullptr;
+    }
+
+    QueueLink* Claim(QueueEntry entry)
+    {
+        auto* linkable = AsLinkable(entry.event);
+        QueueLink* link = nullptr;
+        if ((linkable != nullptr) && !linkable->linked_.test_and_set(std::memory_order_acquire))
+        {
+            link = &linkable->link_;
+        }
+        else
+        {
+            link = fallback_.new_object<QueueLink>();
+        }
+        link->next = nullptr;
+        link->entry = std::move(entry);
+        return link;
+    }
+
+    void PushBack(QueueLink* link)
+    {
+        {
+            std::scoped_lock lock(mutex_);
+            if (tail_ == nullptr)
+            {
+                head_ = link;
+            }
+            else
+            {
+                tail_->next = link;
+            }
+            tail_ = link;
+        }
+        sem_.release();
+    }
+
+    void PushFront(QueueLink* link)
+    {
+        {
+            std::scoped_lock lock(mutex_);
+            link->next = head_;
+            head_ = link;
+            if (tail_ == nullptr)
+            {
+                tail_ = link;
+            }
+        }
+        sem_.release();
+    }
+
+    QueueEntry PopFront()
+    {
+        QueueLink* link = nullptr;
+        {
+            std::scoped_lock lock(mutex_);
+            link = head_;
+            head_ = link->next;
+            if (head_ == nullptr)
+            {
+                tail_ = nullptr;
+            }
+        }
+        auto result = std::move(link->entry);
+        Release(link, result.event);
+        return result;
+    }
+
+    void Release(QueueLink* link)
+    {
+        auto entry = std::move(link->entry);
+        Release(link, entry.event);
+    }
+
+    // Link content has been moved out
+    void Release(QueueLink* link, const cpp_event_framework::Signal::SPtr& event)
+    {
+        auto* linkable = AsLinkable(event);
+        if ((linkable != nullptr) && (link == &linkable->link_))
+        {
+            linkable->linked_.clear(std::memory_order_release);
+        }
+        else
+        {
+            fallback_.delete_object(link);
+        }
+    }
+};
+} // namespace cpp_active_objects
@@ -0,0 +1,336 @@
+/**
+ * @file LockFreeEventQueue.hxx
+ * @author Dirk Ziegelmeier (dirk@ziegelmeier.net)
+ * @brief
+ * @date 16-10-2026
+ *
+ * @copyright SPDX-License-Identifier: Apache-2.0
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <semaphore>
+#include <thread>
+
+#include <cpp_active_objects/IActiveObject.hxx>
+#include <cpp_active_objects/IEventQueue.hxx>
+#include <cpp_event_framework/Concepts.hxx>
+#include <cpp_event_framework/Signal.hxx>
+
+namespace cpp_active_objects
+{
+/**
+ * @brief A lock-free multi-producer/single-consumer event queue
+ * EnqueueBack() and EnqueueFront() may be called from any thread, Dequeue() must only be called from one thread
+ * (the domain thread).
+ * Back entries are kept in an intrusive MPSC FIFO (Vyukov), front entries in a LIFO stack. Dequeue() always
+ * prefers front entries, so ordering is the same as with EventQueue: the most recent EnqueueFront() entry is
+ * dispatched first.
+ *
+ * @tparam SemaphoreType Sempahore type to use - e.g. to be able to supply own RT-capable implementation
+ *         NamedRequirements: DefaultConstructible. No named requirements for release() and acquire() available.
+ */
+template <cpp_event_framework::Semaphore SemaphoreType = std::counting_semaphore<>>
+class LockFreeEventQueue final : public IEventQueue
+{
+public:
+    /**
+     * @brief Shared pointer alias
+     *
+     */
+    using SPtr = std::shared_ptr<LockFreeEventQueue>;
+
+    LockFreeEventQueue() : head_(&stub_), tail_(&stub_)
+    {
+    }
+
+    ~LockFreeEventQueue() override
+    {
+        // Release all entries that have not been dispatched
+        auto* node = tail_->next.load(std::memory_order_acquire);
+        while (node != nullptr)
+        {
+            auto* next = node->next.load(std::memory_order_acquire);
+            delete node;
+            node = next;
+        }
+        if (tail_ != &stub_)
+        {
+            delete tail_;
+        }
+        DeleteList(front_.exchange(nullptr, std::memory_order_acquire));
+        DeleteList(consumer_front_);
+    }
+
+    // Non-copyable, non-movable
+    LockFreeEventQueue(const LockFreeEventQueue& rhs) = delete;
+    LockFreeEventQueue(LockFreeEventQueue&& rhs) = delete;
+    LockFreeEventQueue& operator=(const LockFreeEventQueue& rhs) = delete;
+    LockFreeEventQueue& operator=(LockFreeEventQueue&& rhs) = delete;
+
+    /**
+     * @brief Enqueue an event to be dispatched by a target
+     *
+     * @param target
+     * @param event
+     */
+    void EnqueueBack(IActiveObject::SPtr target, cpp_event_framework::Signal::SPtr event) override
+    {
+        PushBack(new Node{{std::move(target), std::move(event), {}}, nullptr});
+    }
+
+    /**
+     * @brief Enqueue an event to be dispatched by a target
+     *
+     * @param target
+     * @param event
+     */
+    void EnqueueFront(IActiveObject::SPtr target, cpp_event_framework::Signal::SPtr event) override
+    {
+        PushFront(new Node{{std::move(target), std::move(event), {}}, nullptr});
+    }
+
+    /**
+     * @brief Handle overloads are implemented
+     *
+     * @return bool true
+     */
+    [[nodiscard]] bool SupportsHandles() const override
+    {
+        return true;
+    }
+
+    /**
+     * @brief Enqueue an event to be dispatched by a target registered with a handle
+     *
+     * @param target
+     * @param event
+     */
+    void EnqueueBack(ObjectHandle target, cpp_event_framework::Signal::SPtr event) override
+    {
+        PushBack(new Node{{nullptr, std::move(event), target}, nullptr});
+    }
+
+    /**
+     * @brief Enqueue an event to be dispatched by a target registered with a handle
+     *
+     * @param target
+     * @param event
+     */
+    void EnqueueFront(ObjectHandle target, cpp_event_framework::Signal::SPtr event) override
+    {
+        PushFront(new Node{{nullptr, std::move(event), target}, nullptr});
+    }
+
+    /**
+     * @brief Enqueue an intrusive event to be dispatched by a target
+     *
+     * @param target
+     * @param event
+     */
+    void EnqueueBack(IActiveObject::SPtr target, cpp_event_framework::RefCountedSignal<>::IPtr event) override
+    {
+        PushBack(new Node{{std::move(target), nullptr, {}, std::move(event)}, nullptr});
+    }
+
+    /**
+     * @brief Enqueue an intrusive event to be dispatched by a target
+     *
+     * @param target
+     * @param event
+     */
+    void EnqueueFront(IActiveObject::SPtr target, cpp_event_framework::RefCountedSignal<>::IPtr event) override
+    {
+        PushFront(new Node{{std::move(target), nullptr, {}, std::move(event)}, nullptr});
+    }
+
+    /**
+     * @brief Enqueue an intrusive event to be dispatched by a target registered with a handle
+     *
+     * @param target
+     * @param event
+     */
+    void EnqueueBack(ObjectHandle target, cpp_event_framework::RefCountedSignal<>::IPtr event) override
+    {
+        PushBack(new Node{{nullptr, nullptr, target, std::move(event)}, nullptr});
+    }
+
+    /**
+     * @brief Enqueue an intrusive event to be dispatched by a target registered with a handle
+     *
+     * @param target
+     * @param event
+     */
+    void EnqueueFront(ObjectHandle target, cpp_event_framework::RefCountedSignal<>::IPtr event) override
+    {
+        PushFront(new Node{{nullptr, nullptr, target, std::move(event)}, nullptr});
+    }
+
+    /**
+     * @brief Enqueue entries in front of all other entries, keeping their order.
+     * The entries are linked up front and published with a single CAS.
+     *
+     * @param entries
+     */
+    void SpliceFront(EntryList& entries) override
+    {
+        if (entries.empty())
+        {
+            return;
+        }
+
+        // Front stack is newest-first: build chain in list order, its last node links to the current stack
+        Node* chain = nullptr;
+        Node* last = nullptr;
+        for (auto& entry : std::ranges::reverse_view(entries))
+        {
+            auto* node = new Node{std::move(entry), chain};
+            chain = node;
+            if (last == nullptr)
+            {
+                last = node;
+            }
+        }
+        const auto count = entries.size();
+        entries.clear();
+
+        auto* first = front_.load(std::memory_order_relaxed);
+        do
+        {
+            last->next.store(first, std::memory_order_relaxed);
+        } while (!front_.compare_exchange_weak(first, chain, std::memory_order_release, std::memory_order_relaxed));
+        for (size_t i = 0; i < count; i++)
+        {
+            sem_.release();
+        }
+    }
+
+    /**
+     * @brief Dequeue an entry, possibly blocking until there is an entry in the queue
+     *
+     * @return QueueEntry Queue entry
+     */
+    QueueEntry Dequeue() override
+    {
+        sem_.acquire();
+        return PopAcquired();
+    }
+
+    /**
+     * @brief Dequeue an entry, blocking until there is an entry in the queue or the deadline has passed
+     * (SemaphoreType without try_acquire_until(): same as Dequeue())
+     *
+     * @param deadline
+     * @return std::optional<QueueEntry> Queue entry, empty on timeout
+     */
+    std::optional<QueueEntry> DequeueUntil(std::chrono::steady_clock::time_point deadline) override
+    {
+        if constexpr (cpp_event_framework::TimedSemaphore<SemaphoreType>)
+        {
+            if (!sem_.try_acquire_until(deadline))
+            {
+                return std::nullopt;
+            }
+        }
+        else
+        {
+            sem_.acquire();
+        }
+        return PopAcquired();
+    }
+
+private:
+    struct Node
+    {
+        QueueEntry entry;
+        std::atomic<Node*> next;
+    };
+
+    static void DeleteList(Node* node)
+    {
+        while (node != nullptr)
+        {
+            auto* next = node->next.load(std::memory_order_relaxed);
+            delete node;
+            node = next;
+        }
+    }
+
+    Node stub_{{}, nullptr};
+    alignas(64) std::atomic<Node*> head_;
+    alignas(64) std::atomic<Node*> front_ = nullptr;
+    alignas(64) Node* tail_;
+    Node* consumer_front_ = nullptr;
+    SemaphoreType sem_{0};
+
+    void PushBack(Node* node)
+    {
+        auto* prev = head_.exchange(node, std::memory_order_acq_rel);
+        prev->next.store(node, std::memory_order_release);
+        sem_.release();
+    }
+
+    void PushFront(Node* node)
+    {
+        auto* first = front_.load(std::memory_order_relaxed);
+        do
+        {
+            node->next.store(first, std::memory_order_relaxed);
+        } while (!front_.compare_exchange_weak(first, node, std::memory_order_release, std::memory_order_relaxed));
+        sem_.release();
+    }
+
+    // Semaphore has been acquired, an entry is available
+    QueueEntry PopAcquired()
+    {
+        while (true)
+        {
+            // Take over all front entries pushed since last call. The taken list is newest-first,
+            // all of them are newer than the ones we already own -> prepend.
+            auto* taken = front_.exchange(nullptr, std::memory_order_acquire);
+            if (taken != nullptr)
+            {
+                auto* last = taken;
+                while (last->next.load(std::memory_order_relaxed) != nullptr)
+                {
+                    last = last->next.load(std::memory_order_relaxed);
+                }
+                last->next.store(consumer_front_, std::memory_order_relaxed);
+                consumer_front_ = taken;
+            }
+
+            if (consumer_front_ != nullptr)
+            {
+                auto* node = consumer_front_;
+                consumer_front_ = node->next.load(std::memory_order_relaxed);
+                auto result = std::move(node->entry);
+                delete node;
+                return result;
+            }
+
+            auto* tail = tail_;
+            auto* next = tail->next.load(std::memory_order_acquire);
+            if (next != nullptr)
+            {
+                // "next" becomes the new stub node, its payload is handed out
+                auto result = std::move(next->entry);
+                tail_ = next;
+                if (tail != &stub_)
+                {
+                    delete tail;
+                }
+                return result;
+            }
+
+            // Semaphore was released, but a producer that started earlier has not linked its node yet
+            std::this_thread::yield();
+        }
+    }
+};
+} // namespace cpp_active_objects
@@ -0,0 +1,51 @@
+/**
+ * @file ObjectHandle.hxx
+ * @author Dirk Ziegelmeier (dirk@ziegelmeier.net)
+ * @brief
+ * @date 16-10-2026
+ *
+ * @copyright SPDX-License-Identifier: Apache-2.0
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+namespace cpp_active_objects
+{
+/**
+ * @brief Stable handle of an active object registered in a domain's ObjectRegistry.
+ * A handle becomes stale when the object is deregistered, the slot may be reused with a new generation.
+ */
+struct ObjectHandle
+{
+    /**
+     * @brief Index of invalid handle
+     */
+    static constexpr uint32_t kInvalidIndex = std::numeric_limits<uint32_t>::max();
+
+    /**
+     * @brief Registry slot index
+     */
+    uint32_t index = kInvalidIndex;
+    /**
+     * @brief Generation of slot at registration time
+     */
+    uint32_t generation = 0;
+
+    /**
+     * @brief Check whether handle refers to a registry slot (it may still be stale)
+     */
+    [[nodiscard]] bool IsValid() const
+    {
+        return index != kInvalidIndex;
+    }
+
+    /**
+     * @brief Compare handles
+     */
+    bool operator==(const ObjectHandle& rhs) const = default;
+};
+} // namespace cpp_active_objects
@@ -0,0 +1,140 @@
+/**
+ * @file ObjectRegistry.hxx
+ * @author Dirk Ziegelmeier (dirk@ziegelmeier.net)
+ * @brief
+ * @date 16-10-2026
+ *
+ * @copyright SPDX-License-Identifier: Apache-2.0
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include <cpp_active_objects/IActiveObject.hxx>
+#include <cpp_active_objects/ObjectHandle.hxx>
+
+namespace cpp_active_objects
+{
+/**
+ * @brief Fixed-capacity table of active objects addressed by ObjectHandle (slot index and generation).
+ * The registry owns a reference to each registered object, so queue entries only need to carry the handle:
+ * no reference counting per event. Removing an object bumps the slot generation, entries with stale handles
+ * resolve to nullptr.
+ * Add() may be called from any thread, Resolve() and Remove() only from the domain thread.
+ */
+class ObjectRegistry
+{
+public:
+    /**
+     * @brief Default max. number of registered objects
+     */
+    static constexpr size_t kDefaultCapacity = 256;
+
+    /**
+     * @brief Construct a new registry
+     *
+     * @param capacity Max. number of registered objects, storage is allocated once
+     */
+    explicit ObjectRegistry(size_t capacity = kDefaultCapacity) : slots_(capacity)
+    {
+        free_.reserve(capacity);
+        for (size_t i = capacity; i > 0; i--)
+        {
+            free_.emplace_back(static_cast<uint32_t>(i - 1));
+        }
+    }
+
+    ~ObjectRegistry() = default;
+
+    // Non-copyable, non-movable
+    ObjectRegistry(const ObjectRegistry& rhs) = delete;
+    ObjectRegistry(ObjectRegistry&& rhs) = delete;
+    ObjectRegistry& operator=(const ObjectRegistry& rhs) = delete;
+    ObjectRegistry& operator=(ObjectRegistry&& rhs) = delete;
+
+    /**
+     * @brief Register an object
+     *
+     * @param object
+     * @return ObjectHandle Handle of object, invalid handle if registry is full
+     */
+    ObjectHandle Add(IActiveObject::SPtr object)
+    {
+        std::scoped_lock lock(mutex_);
+        if (free_.empty())
+        {
+            return {};
+        }
+
+        const auto index = free_.back();
+        free_.pop_back();
+        auto& slot = slots_.at(index);
+        slot.object = std::move(object);
+        return ObjectHandle{index, slot.generation};
+    }
+
+    /**
+     * @brief Get object of a handle (domain thread only)
+     *
+     * @param handle
+     * @return IActiveObject* nullptr if handle is stale
+     */
+    [[nodiscard]] IActiveObject* Resolve(ObjectHandle handle) const
+    {
+        if (handle.index >= slots_.size())
+        {
+            return nullptr;
+        }
+        const auto& slot = slots_.at(handle.index);
+        return (slot.generation == handle.generation) ? slot.object.get() : nullptr;
+    }
+
+    /**
+     * @brief Deregister an object (domain thread only)
+     *
+     * @param handle
+     * @return IActiveObject::SPtr Registry's reference to the object, nullptr if handle is stale
+     */
+    IActiveObject::SPtr Remove(ObjectHandle handle)
+    {
+        if (Resolve(handle) == nullptr)
+        {
+            return nullptr;
+        }
+
+        auto& slot = slots_.at(handle.index);
+        slot.generation++;
+        auto object = std::move(slot.object);
+
+        std::scoped_lock lock(mutex_);
+        free_.emplace_back(handle.index);
+        return object;
+    }
+
+    /**
+     * @brief Number of registered objects
+     */
+    [[nodiscard]] size_t Size() const
+    {
+        std::scoped_lock lock(mutex_);
+        return slots_.size() - free_.size();
+    }
+
+private:
+    struct Slot
+    {
+        IActiveObject::SPtr object;
+        uint32_t generation = 0;
+    };
+
+    // Never resized: Add() of one slot must not move slots being resolved by the domain thread
+    std::vector<Slot> slots_;
+    std::vector<uint32_t> free_;
+    mutable std::mutex mutex_;
+};
+} // namespace cpp_active_objects
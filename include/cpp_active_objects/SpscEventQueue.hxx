@@ -0,0 +1,300 @@
+/**
+ * @file SpscEventQueue.hxx
+ * @author Dirk Ziegelmeier (dirk@ziegelmeier.net)
+ * @brief
+ * @date 16-10-2026
+ *
+ * @copyright SPDX-License-Identifier: Apache-2.0
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <list>
+#include <memory>
+#include <optional>
+#include <semaphore>
+#include <thread>
+
+#include <cpp_active_objects/IActiveObject.hxx>
+#include <cpp_active_objects/IEventQueue.hxx>
+#include <cpp_event_framework/Concepts.hxx>
+#include <cpp_event_framework/Signal.hxx>
+#include <cpp_event_framework/SpscRing.hxx>
+
+namespace cpp_active_objects
+{
+/**
+ * @brief A lock-free bounded single-producer/single-consumer event queue, back entries are allocation-free.
+ * EnqueueBack() must only be called from ONE producer thread, Dequeue() from ONE consumer thread (the domain
+ * thread). EnqueueFront() and SpliceFront() must only be called from the consumer thread, e.g. by Hsm when recalling
+ * deferred events from a dispatch. Front entries are dispatched before back entries, the most recent EnqueueFront()
+ * first, SpliceFront() keeps the order of the spliced entries.
+ * Front entries are unbounded: SpliceFront() takes over the list nodes of the entries, EnqueueFront() reuses nodes
+ * of dequeued front entries and only allocates when there is none.
+ * EnqueueFront() asserts the calling thread once the consumer has started dequeuing, i.e. TakeHighPrio() of objects
+ * in a domain using this queue is restricted to the domain thread.
+ * Note the domain's Stop() also enqueues (back) - destroy the domain only when the producer is done.
+ *
+ * @tparam Capacity Max. number of EnqueueBack() entries
+ * @tparam FullPolicy What to do when EnqueueBack() finds the queue full
+ * @tparam SemaphoreType Sempahore type to use - e.g. to be able to supply own RT-capable implementation
+ */
+template <size_t Capacity,
+          cpp_event_framework::EQueueFullPolicy FullPolicy = cpp_event_framework::EQueueFullPolicy::kAssert,
+          cpp_event_framework::Semaphore SemaphoreType = std::counting_semaphore<>,
+          cpp_event_framework::AssertionProvider AssertionProviderType = cpp_event_framework::DefaultAssertionProvider>
+class SpscEventQueue final : public IEventQueue
+{
+public:
+    /**
+     * @brief Shared pointer alias
+     *
+     */
+    using SPtr = std::shared_ptr<SpscEventQueue>;
+
+    SpscEventQueue() = default;
+    ~SpscEventQueue() override = default;
+
+    // Non-copyable, non-movable
+    SpscEventQueue(const SpscEventQueue& rhs) = delete;
+    SpscEventQueue(SpscEventQueue&& rhs) = delete;
+    SpscEventQueue& operator=(const SpscEventQueue& rhs) = delete;
+    SpscEventQueue& operator=(SpscEventQueue&& rhs) = delete;
+
+    /**
+     * @brief Enqueue an event to be dispatched by a target (producer thread only)
+     *
+     * @param target
+     * @param event
+     */
+    void EnqueueBack(IActiveObject::SPtr target, cpp_event_framework::Signal::SPtr event) override
+    {
+        PushBack(QueueEntry{std::move(target), std::move(event), {}});
+    }
+
+    /**
+     * @brief Enqueue an event to be dispatched by a target (consumer thread only)
+     *
+     * @param target
+     * @param event
+     */
+    void EnqueueFront(IActiveObject::SPtr target, cpp_event_framework::Signal::SPtr event) override
+    {
+        PushFront(QueueEntry{std::move(target), std::move(event), {}});
+    }
+
+    /**
+     * @brief Handle overloads are implemented
+     *
+     * @return bool true
+     */
+    [[nodiscard]] bool SupportsHandles() const override
+    {
+        return true;
+    }
+
+    /**
+     * @brief Enqueue an event to be dispatched by a target registered with a handle (producer thread only)
+     *
+     * @param target
+     * @param event
+     */
+    void EnqueueBack(ObjectHandle target, cpp_event_framework::Signal::SPtr event) override
+    {
+        PushBack(QueueEntry{nullptr, std::move(event), target});
+    }
+
+    /**
+     * @brief Enqueue an event to be dispatched by a target registered with a handle (consumer thread only)
+     *
+     * @param target
+     * @param event
+     */
+    void EnqueueFront(ObjectHandle target, cpp_event_framework::Signal::SPtr event) override
+    {
+        PushFront(QueueEntry{nullptr, std::move(event), target});
+    }
+
+    /**
+     * @brief Enqueue an intrusive event to be dispatched by a target (producer thread only)
+     *
+     * @param target
+     * @param event
+     */
+    void EnqueueBack(IActiveObject::SPtr target, cpp_event_framework::RefCountedSignal<>::IPtr event) override
+    {
+        PushBack(QueueEntry{std::move(target), nullptr, {}, std::move(event)});
+    }
+
+    /**
+     * @brief Enqueue an intrusive event to be dispatched by a target (consumer thread only)
+     *
+     * @param target
+     * @param event
+     */
+    void EnqueueFront(IActiveObject::SPtr target, cpp_event_framework::RefCountedSignal<>::IPtr event) override
+    {
+        PushFront(QueueEntry{std::move(target), nullptr, {}, std::move(event)});
+    }
+
+    /**
+     * @brief Enqueue an intrusive event to be dispatched by a target registered with a handle (producer thread only)
+     *
+     * @param target
+     * @param event
+     */
+    void EnqueueBack(ObjectHandle target, cpp_event_framework::RefCountedSignal<>::IPtr event) override
+    {
+        PushBack(QueueEntry{nullptr, nullptr, target, std::move(event)});
+    }
+
+    /**
+     * @brief Enqueue an intrusive event to be dispatched by a target registered with a handle (consumer thread only)
+     *
+     * @param target
+     * @param event
+     */
+    void EnqueueFront(ObjectHandle target, cpp_event_framework::RefCountedSignal<>::IPtr event) override
+    {
+        PushFront(QueueEntry{nullptr, nullptr, target, std::move(event)});
+    }
+
+    /**
+     * @brief Enqueue entries in front of all other entries, keeping their order (consumer thread only).
+     * Takes over the list nodes, entries is empty afterwards.
+     *
+     * @param entries
+     */
+    void SpliceFront(EntryList& entries) override
+    {
+        AssertionProviderType::Assert(IsConsumerThread());
+        const auto count = entries.size();
+        front_.splice(front_.begin(), entries);
+        for (size_t i = 0; i < count; i++)
+        {
+            sem_.release();
+        }
+    }
+
+    /**
+     * @brief Dequeue an entry, possibly blocking until there is an entry in the queue
+     *
+     * @return QueueEntry Queue entry
+     */
+    QueueEntry Dequeue() override
+    {
+        consumer_.store(std::this_thread::get_id(), std::memory_order_relaxed);
+        sem_.acquire();
+        return PopAcquired();
+    }
+
+    /**
+     * @brief Dequeue an entry, blocking until there is an entry in the queue or the deadline has passed
+     * (SemaphoreType without try_acquire_until(): same as Dequeue())
+     *
+     * @param deadline
+     * @return std::optional<QueueEntry> Queue entry, empty on timeout
+     */
+    std::optional<QueueEntry> DequeueUntil(std::chrono::steady_clock::time_point deadline) override
+    {
+        consumer_.store(std::this_thread::get_id(), std::memory_order_relaxed);
+        if constexpr (cpp_event_framework::TimedSemaphore<SemaphoreType>)
+        {
+            if (!sem_.try_acquire_until(deadline))
+            {
+                return std::nullopt;
+            }
+        }
+        else
+        {
+            sem_.acquire();
+        }
+        return PopAcquired();
+    }
+
+    /**
+     * @brief Number of entries discarded because the queue was full (EQueueFullPolicy::kDrop)
+     *
+     * @return size_t
+     */
+    [[nodiscard]] size_t Dropped() const
+    {
+        return dropped_.load(std::memory_order_relaxed);
+    }
+
+private:
+    cpp_event_framework::SpscRing<QueueEntry, Capacity> ring_;
+    // Front entries and nodes of dequeued front entries, consumer thread only
+    EntryList front_;
+    EntryList spare_nodes_;
+    std::atomic<size_t> dropped_ = 0;
+    SemaphoreType sem_{0};
+    // Thread that called Dequeue() last, default-constructed until then
+    std::atomic<std::thread::id> consumer_;
+
+    [[nodiscard]] bool IsConsumerThread() const
+    {
+        const auto consumer = consumer_.load(std::memory_order_relaxed);
+        return (consumer == std::thread::id()) || (consumer == std::this_thread::get_id());
+    }
+
+    void PushBack(QueueEntry entry)
+    {
+        while (!ring_.TryPush(entry))
+        {
+            if constexpr (FullPolicy == cpp_event_framework::EQueueFullPolicy::kAssert)
+            {
+                AssertionProviderType::Assert(false);
+                return;
+            }
+            else if constexpr (FullPolicy == cpp_event_framework::EQueueFullPolicy::kDrop)
+            {
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+        sem_.release();
+    }
+
+    void PushFront(QueueEntry entry)
+    {
+        AssertionProviderType::Assert(IsConsumerThread());
+        if (spare_nodes_.empty())
+        {
+            front_.emplace_front(std::move(entry));
+        }
+        else
+        {
+            front_.splice(front_.begin(), spare_nodes_, spare_nodes_.begin());
+            front_.front() = std::move(entry);
+        }
+        sem_.release();
+    }
+
+    // Semaphore has been acquired, an entry is available
+    QueueEntry PopAcquired()
+    {
+        QueueEntry result;
+        if (!front_.empty())
+        {
+            result = std::move(front_.front());
+            front_.front() = QueueEntry();
+            spare_nodes_.splice(spare_nodes_.begin(), front_, front_.begin());
+        }
+        else
+        {
+            // Producer pushes before releasing the semaphore, so pop cannot fail
+            [[maybe_unused]] auto ok = ring_.TryPop(result);
+            AssertionProviderType::Assert(ok);
+        }
+        return result;
+    }
+};
+} // namespace cpp_active_objects
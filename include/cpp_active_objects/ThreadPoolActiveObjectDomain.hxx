@@ -0,0 +1,448 @@
+/**
+ * @file ThreadPoolActiveObjectDomain.hxx
+ * @author Dirk Ziegelmeier (dirk@ziegelmeier.net)
+ * @brief
+ * @date 16-10-2026
+ *
+ * @copyright SPDX-License-Identifier: Apache-2.0
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <deque>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <semaphore>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include <cpp_active_objects/ActiveObjectDomainBase.hxx>
+#include <cpp_active_objects/IActiveObject.hxx>
+#include <cpp_active_objects/IEventSink.hxx>
+#include <cpp_active_objects/ObjectRegistry.hxx>
+#include <cpp_event_framework/Concepts.hxx>
+#include <cpp_event_framework/Signal.hxx>
+#include <cpp_event_framework/SpscRing.hxx>
+
+namespace cpp_active_objects
+{
+/**
+ * @brief Active object domain that dispatches events on a pool of worker threads with work stealing.
+ * Every registered object gets its own mailbox queue. A mailbox is scheduled on a worker when it becomes non-empty
+ * and is owned by exactly one worker at a time, so Dispatch() of an object never runs concurrently with itself and
+ * events of one object are dispatched in queue order (run-to-completion of Hsm is preserved).
+ * Idle workers steal scheduled mailboxes from other workers.
+ *
+ * @tparam ThreadType Thread type to use - e.g. to be able to use own RT-capable implementation
+ * @tparam MutexType Mutex type to use - e.g. to be able to supply own RT-capable implementation.
+ *         NamedRequirements: DefaultConstructible, Destructible, BasicLockable
+ */
+template <typename ThreadType = std::jthread, cpp_event_framework::Mutex MutexType = std::mutex>
+class ThreadPoolActiveObjectDomain : public ActiveObjectDomainBase
+{
+public:
+    /**
+     * @brief Shared pointer alias
+     *
+     */
+    using SPtr = std::shared_ptr<ThreadPoolActiveObjectDomain>;
+
+    /**
+     * @brief Max. number of events dispatched from one mailbox before it is rescheduled (fairness)
+     */
+    static constexpr size_t kDispatchBatchSize = 32;
+
+    /**
+     * @brief Constructor
+     *
+     * @param num_threads Number of worker threads
+     */
+    explicit ThreadPoolActiveObjectDomain(size_t num_threads = std::thread::hardware_concurrency())
+        : ActiveObjectDomainBase(nullptr) // No domain queue: Run(), Stop() and DeregisterObject() are not used
+    {
+        if (num_threads == 0)
+        {
+            num_threads = 1;
+        }
+
+        for (size_t i = 0; i < num_threads; i++)
+        {
+            workers_.emplace_back(std::make_unique<WorkerQueue>());
+        }
+        for (size_t i = 0; i < num_threads; i++)
+        {
+            threads_.emplace_back(RunWrapper, this, i);
+        }
+    }
+
+    ~ThreadPoolActiveObjectDomain() override
+    {
+        // Workers exit when all scheduled mailboxes have been drained
+        stopping_ = true;
+        work_available_.release(static_cast<std::ptrdiff_t>(threads_.size()));
+        for (auto& thread : threads_)
+        {
+            thread.join();
+        }
+
+        // Objects may outlive the domain - events taken afterwards are queued, but never dispatched
+        std::scoped_lock lock(mailboxes_mutex_);
+        for (const auto& weak_mailbox : mailboxes_)
+        {
+            if (auto mailbox = weak_mailbox.lock())
+            {
+                mailbox->Detach();
+            }
+        }
+    }
+
+    // Non-copyable, non-movable
+    ThreadPoolActiveObjectDomain(const ThreadPoolActiveObjectDomain& rhs) = delete;
+    ThreadPoolActiveObjectDomain(ThreadPoolActiveObjectDomain&& rhs) = delete;
+    ThreadPoolActiveObjectDomain& operator=(const ThreadPoolActiveObjectDomain& rhs) = delete;
+    ThreadPoolActiveObjectDomain& operator=(ThreadPoolActiveObjectDomain&& rhs) = delete;
+
+    /**
+     * @brief Get number of worker threads
+     *
+     * @return size_t
+     */
+    [[nodiscard]] size_t NumThreads() const
+    {
+        return threads_.size();
+    }
+
+    /**
+     * @brief Get worker thread object
+     *
+     * @param index Worker index
+     * @return ThreadType&
+     */
+    ThreadType& Thread(size_t index)
+    {
+        return threads_.at(index);
+    }
+
+protected:
+    /**
+     * @brief Time events are not supported, workers do not run the domain's timer service
+     *
+     * @return TimerService* nullptr
+     */
+    TimerService* ObjectTimerService() override
+    {
+        return nullptr;
+    }
+
+    /**
+     * @brief Object handles are not supported, each object has its own mailbox anyway.
+     * RegisterObjectWithHandle() registers objects by reference.
+     *
+     * @return ObjectRegistry* nullptr
+     */
+    ObjectRegistry* ObjectHandles() override
+    {
+        return nullptr;
+    }
+
+    /**
+     * @brief Create a mailbox for each registered object
+     *
+     * @return IEventSink::SPtr
+     */
+    IEventSink::SPtr ObjectQueue(const IActiveObject::SPtr& active_object) override
+    {
+        auto mailbox = std::make_shared<Mailbox>(this, active_object);
+
+        std::scoped_lock lock(mailboxes_mutex_);
+        std::erase_if(mailboxes_, [](const auto& weak_mailbox) { return weak_mailbox.expired(); });
+        mailboxes_.emplace_back(mailbox);
+        return mailbox;
+    }
+
+private:
+    /**
+     * @brief Per-object event queue, scheduled on the worker pool while it contains events.
+     * Only the enqueue side is an interface, entries are taken out by Run() of the worker that owns the mailbox.
+     */
+    class Mailbox final : public IEventSink, public std::enable_shared_from_this<Mailbox>
+    {
+    public:
+        Mailbox(ThreadPoolActiveObjectDomain* domain, const IActiveObject::SPtr& owner)
+            : domain_(domain), owner_(owner)
+        {
+        }
+
+        void EnqueueBack(std::shared_ptr<IActiveObject> target, cpp_event_framework::Signal::SPtr event) override
+        {
+            std::scoped_lock lock(mutex_);
+            queue_.emplace_back(std::move(target), std::move(event));
+            ScheduleLocked();
+        }
+
+        void EnqueueFront(std::shared_ptr<IActiveObject> target, cpp_event_framework::Signal::SPtr event) override
+        {
+            std::scoped_lock lock(mutex_);
+            queue_.emplace_front(std::move(target), std::move(event));
+            front_entries_++;
+            ScheduleLocked();
+        }
+
+        void EnqueueBack(std::shared_ptr<IActiveObject> target,
+                         cpp_event_framework::RefCountedSignal<>::IPtr event) override
+        {
+            std::scoped_lock lock(mutex_);
+            queue_.emplace_back(std::move(target), nullptr, ObjectHandle(), std::move(event));
+            ScheduleLocked();
+        }
+
+        void EnqueueFront(std::shared_ptr<IActiveObject> target,
+                          cpp_event_framework::RefCountedSignal<>::IPtr event) override
+        {
+            std::scoped_lock lock(mutex_);
+            queue_.emplace_front(std::move(target), nullptr, ObjectHandle(), std::move(event));
+            front_entries_++;
+            ScheduleLocked();
+        }
+
+        [[nodiscard]] bool SupportsHandles() const override
+        {
+            return true;
+        }
+
+        // Thread pool domains have no object registry (see ObjectHandles()), a mailbox only holds events of the
+        // object it was created for. Events for an object that is gone are dropped, like for a stale handle.
+        void EnqueueBack(ObjectHandle /*target*/, cpp_event_framework::Signal::SPtr event) override
+        {
+            if (auto owner = owner_.lock())
+            {
+                EnqueueBack(std::move(owner), std::move(event));
+            }
+        }
+
+        void EnqueueFront(ObjectHandle /*target*/, cpp_event_framework::Signal::SPtr event) override
+        {
+            if (auto owner = owner_.lock())
+            {
+                EnqueueFront(std::move(owner), std::move(event));
+            }
+        }
+
+        void EnqueueBack(ObjectHandle /*target*/, cpp_event_framework::RefCountedSignal<>::IPtr event) override
+        {
+            if (auto owner = owner_.lock())
+            {
+                EnqueueBack(std::move(owner), std::move(event));
+            }
+        }
+
+        void EnqueueFront(ObjectHandle /*target*/, cpp_event_framework::RefCountedSignal<>::IPtr event) override
+        {
+            if (auto owner = owner_.lock())
+            {
+                EnqueueFront(std::move(owner), std::move(event));
+            }
+        }
+
+        void SpliceFront(EntryList& entries) override
+        {
+            std::scoped_lock lock(mutex_);
+            front_entries_ += entries.size();
+            queue_.splice(queue_.begin(), entries);
+            ScheduleLocked();
+        }
+
+        /**
+         * @brief Dispatch up to kDispatchBatchSize consecutive entries for the same target in one call,
+         * called by the worker that owns the mailbox. Events the target did not dispatch (see
+         * IActiveObject::Dispatch(std::span)) are put back behind the entries enqueued at the front meanwhile.
+         */
+        void Run()
+        {
+            std::shared_ptr<IActiveObject> target;
+            cpp_event_framework::RefCountedSignal<>::IPtr intrusive_event;
+            {
+                std::scoped_lock lock(mutex_);
+                if (queue_.empty())
+                {
+                    scheduled_ = false;
+                    return;
+                }
+                target = queue_.front().target;
+                front_entries_ = 0;
+
+                // Intrusive events are dispatched one by one, batches only consist of std::shared_ptr events
+                if (queue_.front().intrusive_event != nullptr)
+                {
+                    intrusive_event = std::move(queue_.front().intrusive_event);
+                    queue_.pop_front();
+                }
+                while ((intrusive_event == nullptr) && !queue_.empty() && (queue_.front().target == target) &&
+                       (queue_.front().intrusive_event == nullptr) && (batch_.size() < kDispatchBatchSize))
+                {
+                    batch_.emplace_back(std::move(queue_.front().event));
+                    queue_.pop_front();
+                }
+            }
+            if (intrusive_event != nullptr)
+            {
+                target->Dispatch(intrusive_event);
+            }
+            else
+            {
+                const auto processed = target->Dispatch(std::span<const cpp_event_framework::Signal::SPtr>(batch_));
+                assert(processed > 0);
+                batch_.erase(batch_.begin(), batch_.begin() + static_cast<std::ptrdiff_t>(processed));
+            }
+
+            // Events left - reschedule, give other mailboxes a chance
+            std::scoped_lock lock(mutex_);
+            const auto position = std::next(queue_.begin(), static_cast<std::ptrdiff_t>(front_entries_));
+            for (auto& event : batch_)
+            {
+                queue_.emplace(position, target, std::move(event));
+            }
+            batch_.clear();
+            scheduled_ = false;
+            ScheduleLocked();
+        }
+
+        void Detach()
+        {
+            std::scoped_lock lock(mutex_);
+            domain_ = nullptr;
+        }
+
+    private:
+        void ScheduleLocked()
+        {
+            if (!scheduled_ && !queue_.empty() && (domain_ != nullptr))
+            {
+                scheduled_ = true;
+                domain_->Schedule(this->shared_from_this());
+            }
+        }
+
+        MutexType mutex_;
+        std::list<QueueEntry> queue_;
+        // Events being dispatched, only used by the worker running this mailbox
+        std::vector<cpp_event_framework::Signal::SPtr> batch_;
+        // Entries enqueued at the front since the worker took the batch
+        size_t front_entries_ = 0;
+        bool scheduled_ = false;
+        ThreadPoolActiveObjectDomain* domain_ = nullptr;
+        // Weak: the object holds its mailbox
+        std::weak_ptr<IActiveObject> owner_;
+    };
+
+    struct alignas(cpp_event_framework::kCacheLineSize) WorkerQueue
+    {
+        MutexType mutex;
+        std::deque<std::shared_ptr<Mailbox>> mailboxes;
+    };
+
+    struct WorkerContext
+    {
+        const ThreadPoolActiveObjectDomain* domain = nullptr;
+        size_t index = 0;
+    };
+
+    static inline thread_local WorkerContext tls_worker_;
+
+    std::vector<std::unique_ptr<WorkerQueue>> workers_;
+    std::vector<ThreadType> threads_;
+    std::counting_semaphore<> work_available_{0};
+    std::atomic<bool> stopping_ = false;
+    std::atomic<size_t> next_worker_ = 0;
+    MutexType mailboxes_mutex_;
+    std::vector<std::weak_ptr<Mailbox>> mailboxes_;
+
+    void Schedule(std::shared_ptr<Mailbox> mailbox)
+    {
+        // Workers keep rescheduled mailboxes local, other threads distribute round-robin
+        size_t index = 0;
+        if (tls_worker_.domain == this)
+        {
+            index = tls_worker_.index;
+        }
+        else
+        {
+            index = next_worker_.fetch_add(1, std::memory_order_relaxed) % workers_.size();
+        }
+
+        {
+            auto& worker = *workers_.at(index);
+            std::scoped_lock lock(worker.mutex);
+            worker.mailboxes.emplace_back(std::move(mailbox));
+        }
+        work_available_.release();
+    }
+
+    std::shared_ptr<Mailbox> TakeWork(size_t index)
+    {
+        // Own queue first (FIFO)...
+        {
+            auto& worker = *workers_.at(index);
+            std::scoped_lock lock(worker.mutex);
+            if (!worker.mailboxes.empty())
+            {
+                auto result = std::move(worker.mailboxes.front());
+                worker.mailboxes.pop_front();
+                return result;
+            }
+        }
+
+        // ... then steal from the back of the others
+        for (size_t i = 1; i < workers_.size(); i++)
+        {
+            auto& victim = *workers_.at((index + i) % workers_.size());
+            std::scoped_lock lock(victim.mutex);
+            if (!victim.mailboxes.empty())
+            {
+                auto result = std::move(victim.mailboxes.back());
+                victim.mailboxes.pop_back();
+                return result;
+            }
+        }
+
+        return nullptr;
+    }
+
+    void WorkerRun(size_t index)
+    {
+        tls_worker_ = {this, index};
+
+        while (true)
+        {
+            work_available_.acquire();
+
+            auto mailbox = TakeWork(index);
+            while (mailbox == nullptr)
+            {
+                if (stopping_)
+                {
+                    return;
+                }
+                // Tokens and scheduled mailboxes only diverge while stopping
+                std::this_thread::yield();
+                mailbox = TakeWork(index);
+            }
+
+            mailbox->Run();
+        }
+    }
+
+    static void RunWrapper(void* arg, size_t index)
+    {
+        auto me = static_cast<ThreadPoolActiveObjectDomain*>(arg);
+        me->WorkerRun(index);
+    }
+};
+} // namespace cpp_active_objects
@@ -0,0 +1,268 @@
+/**
+ * @file TimerService.hxx
+ * @author Dirk Ziegelmeier (dirk@ziegelmeier.net)
+ * @brief
+ * @date 16-10-2026
+ *
+ * @copyright SPDX-License-Identifier: Apache-2.0
+ *
+ */
+
+#pragma once
+
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <cpp_active_objects/IActiveObject.hxx>
+#include <cpp_active_objects/ObjectHandle.hxx>
+#include <cpp_active_objects/ObjectRegistry.hxx>
+#include <cpp_event_framework/Signal.hxx>
+#include <cpp_event_framework/TimingWheel.hxx>
+
+namespace cpp_active_objects
+{
+class TimerService;
+
+/**
+ * @brief Base class for time event signals. Use it as signal base class, e.g.
+ * class Timeout : public cpp_event_framework::NextSignal<Timeout, PreviousSignal, cpp_active_objects::TimeEvent>
+ * Time events are created once (from the signal's allocator, e.g. a pool) and armed/disarmed as often as needed,
+ * arming never allocates. While armed, the timer service holds a reference to the event and its target, or only
+ * the handle of targets registered with a handle: time events of deregistered objects are dropped.
+ */
+class TimeEvent : public cpp_event_framework::Signal, private cpp_event_framework::TimingWheelNode
+{
+public:
+    /**
+     * @brief Shared pointer alias
+     *
+     */
+    using SPtr = std::shared_ptr<TimeEvent>;
+
+    using cpp_event_framework::TimingWheelNode::IsArmed;
+
+protected:
+    /**
+     * @brief Constructor
+     *
+     * @param signal_id Signal ID
+     */
+    explicit TimeEvent(IdType signal_id) : Signal(signal_id)
+    {
+    }
+
+private:
+    friend class TimerService;
+
+    cpp_event_framework::Signal::SPtr self_;
+    IActiveObject::SPtr target_;
+    ObjectHandle handle_;
+    uint64_t period_ = 0;
+};
+
+/**
+ * @brief Timer service of an active object domain, based on a hierarchical timing wheel.
+ * Expired time events are dispatched directly to their target from the domain thread (no queue hop).
+ * Not thread-safe: Arm()/Disarm() must be called from the domain thread, e.g. from statemachine actions of
+ * objects registered in the domain.
+ */
+class TimerService
+{
+public:
+    /**
+     * @brief Clock type
+     */
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Construct a new timer service
+     *
+     * @param handles Registry to resolve handle targets with, nullptr: Arm() with handle is not supported
+     * @param tick Timer resolution
+     */
+    explicit TimerService(const ObjectRegistry* handles = nullptr,
+                          Clock::duration tick = std::chrono::milliseconds(1))
+        : handles_(handles), tick_(tick), epoch_(Clock::now())
+    {
+    }
+
+    ~TimerService()
+    {
+        wheel_.Clear([](cpp_event_framework::TimingWheelNode& node) { Release(static_cast<TimeEvent&>(node)); });
+    }
+
+    // Non-copyable, non-movable
+    TimerService(const TimerService& rhs) = delete;
+    TimerService(TimerService&& rhs) = delete;
+    TimerService& operator=(const TimerService& rhs) = delete;
+    TimerService& operator=(TimerService&& rhs) = delete;
+
+    /**
+     * @brief Arm a time event, re-arms it when it is already armed
+     *
+     * @param event Time event
+     * @param target Object to dispatch event to when it expires
+     * @param delay Delay, rounded up to timer resolution
+     * @param period Re-arm period after expiry, zero: one-shot
+     */
+    void Arm(const TimeEvent::SPtr& event, IActiveObject::SPtr target, Clock::duration delay,
+             Clock::duration period = Clock::duration::zero())
+    {
+        assert(event != nullptr);
+        assert(target != nullptr);
+
+        event->target_ = std::move(target);
+        event->handle_ = ObjectHandle();
+        ArmEvent(event, delay, period);
+    }
+
+    /**
+     * @brief Arm a time event for an object registered with a handle, re-arms it when it is already armed.
+     * The event is dropped when the object has been deregistered before it expires.
+     *
+     * @param event Time event
+     * @param target Handle of object to dispatch event to when it expires
+     * @param delay Delay, rounded up to timer resolution
+     * @param period Re-arm period after expiry, zero: one-shot
+     */
+    void Arm(const TimeEvent::SPtr& event, ObjectHandle target, Clock::duration delay,
+             Clock::duration period = Clock::duration::zero())
+    {
+        assert(event != nullptr);
+        assert(target.IsValid());
+        assert(handles_ != nullptr);
+
+        event->target_.reset();
+        event->handle_ = target;
+        ArmEvent(event, delay, period);
+    }
+
+    /**
+     * @brief Disarm a time event
+     *
+     * @param event Time event
+     * @return true Event was armed
+     */
+    bool Disarm(TimeEvent& event)
+    {
+        if (!wheel_.Cancel(event))
+        {
+            return false;
+        }
+        Release(event);
+        return true;
+    }
+
+    /**
+     * @brief Check whether no time event is armed
+     */
+    [[nodiscard]] bool Empty() const
+    {
+        return wheel_.Empty();
+    }
+
+    /**
+     * @brief Number of armed time events
+     */
+    [[nodiscard]] size_t Size() const
+    {
+        return wheel_.Size();
+    }
+
+    /**
+     * @brief Time when Process() has work to do next, never later than the earliest expiry
+     *
+     * @return Clock::time_point Clock::time_point::max() when no event is armed
+     */
+    [[nodiscard]] Clock::time_point NextExpiry() const
+    {
+        const auto tick = wheel_.NextEventTick();
+        if (tick == Wheel::kNever)
+        {
+            return Clock::time_point::max();
+        }
+        return epoch_ + (tick_ * static_cast<Clock::rep>(tick));
+    }
+
+    /**
+     * @brief Dispatch all expired time events
+     *
+     * @return size_t Number of dispatched events
+     */
+    size_t Process()
+    {
+        if (wheel_.Empty())
+        {
+            return 0;
+        }
+
+        const auto now = static_cast<uint64_t>((Clock::now() - epoch_) / tick_);
+        return wheel_.Advance(now,
+                              [this](cpp_event_framework::TimingWheelNode& node)
+                              {
+                                  auto& event = static_cast<TimeEvent&>(node);
+                                  // Stale handle: object has been deregistered, drop event
+                                  auto* target = Target(event);
+                                  if ((event.period_ != 0) && (target != nullptr))
+                                  {
+                                      wheel_.Arm(event, event.period_);
+                                      auto signal = event.self_;
+                                      auto reference = event.target_;
+                                      target->Dispatch(signal);
+                                  }
+                                  else
+                                  {
+                                      auto signal = std::move(event.self_);
+                                      auto reference = std::move(event.target_);
+                                      if (target != nullptr)
+                                      {
+                                          target->Dispatch(signal);
+                                      }
+                                  }
+                              });
+    }
+
+private:
+    using Wheel = cpp_event_framework::TimingWheel<>;
+
+    const ObjectRegistry* handles_;
+    Clock::duration tick_;
+    Clock::time_point epoch_;
+    Wheel wheel_;
+
+    // Round up to ticks
+    [[nodiscard]] uint64_t Ticks(Clock::duration duration) const
+    {
+        return static_cast<uint64_t>((duration + tick_ - Clock::duration(1)) / tick_);
+    }
+
+    void ArmEvent(const TimeEvent::SPtr& event, Clock::duration delay, Clock::duration period)
+    {
+        event->self_ = event;
+        event->period_ = (period > Clock::duration::zero()) ? Ticks(period) : 0;
+
+        // Expiry relative to current time, wheel time may lag behind
+        const uint64_t expiry = Ticks((Clock::now() - epoch_) + delay);
+        wheel_.Arm(*event, (expiry > wheel_.Now()) ? (expiry - wheel_.Now()) : 1);
+    }
+
+    [[nodiscard]] IActiveObject* Target(const TimeEvent& event) const
+    {
+        if (event.handle_.IsValid())
+        {
+            return handles_->Resolve(event.handle_);
+        }
+        return event.target_.get();
+    }
+
+    static void Release(TimeEvent& event)
+    {
+        // Event may be destroyed when the last reference is dropped
+        auto signal = std::move(event.self_);
+        event.target_.reset();
+    }
+};
+} // namespace cpp_active_objects
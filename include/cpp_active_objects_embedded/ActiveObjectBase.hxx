@@ -10,8 +10,15 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <span>
+#include <thread>
+
 #include <cpp_active_objects_embedded/IActiveObject.hxx>
 #include <cpp_active_objects_embedded/IEventQueue.hxx>
+#include <cpp_active_objects_embedded/TimerService.hxx>
 #include <cpp_event_framework/Signal.hxx>
 
 namespace cpp_active_objects_embedded
@@ -23,6 +30,8 @@ namespace cpp_active_objects_embedded
 class ActiveObjectBase : public IActiveObject
 {
 public:
+    using IActiveObject::Dispatch;
+
     /**
      * @brief Assign object to a queue
      *
@@ -34,6 +43,16 @@ public:
         queue_ = queue;
     }
 
+    /**
+     * @brief Set the timer service of the domain the object is registered in
+     *
+     * @param timers
+     */
+    void SetTimerService(TimerService* timers) final
+    {
+        timers_ = timers;
+    }
+
     /**
      * @brief Enqueue (back) a signal to be dispatched by this object
      *
@@ -45,6 +64,19 @@ public:
         queue_->EnqueueBack(this, event);
     }
 
+    /**
+     * @brief Enqueue (back) a signal to be dispatched by this object, with an explicit priority instead of the
+     * signal's Priority()
+     *
+     * @param event
+     * @param priority
+     */
+    void Take(const cpp_event_framework::Signal::SPtr& event, cpp_event_framework::Signal::PriorityType priority) final
+    {
+        assert(queue_ != nullptr);
+        queue_->EnqueueBack(this, event, priority);
+    }
+
     /**
      * @brief Enqueue (back) a signal to be dispatched by this object
      *
@@ -54,12 +86,139 @@ public:
     {
         assert(queue_ != nullptr);
         queue_->EnqueueFront(this, event);
+        FrontEntryTaken();
+    }
+
+    /**
+     * @brief Enqueue (back) an intrusive reference counted event to be dispatched by this object
+     *
+     * @param event
+     */
+    void Take(const cpp_event_framework::RefCountedSignal<>::IPtr& event) final
+    {
+        assert(queue_ != nullptr);
+        queue_->EnqueueBack(this, event);
+    }
+
+    /**
+     * @brief Enqueue (front) an intrusive reference counted event to be dispatched by this object
+     *
+     * @param event
+     */
+    void TakeHighPrio(const cpp_event_framework::RefCountedSignal<>::IPtr& event) final
+    {
+        assert(queue_ != nullptr);
+        queue_->EnqueueFront(this, event);
+        FrontEntryTaken();
+    }
+
+    /**
+     * @brief Dispatch consecutive queue entries one by one, returns after an event during which the object took
+     * an event via TakeHighPrio()
+     *
+     * @param events
+     * @return size_t Number of dispatched events
+     */
+    size_t Dispatch(std::span<const cpp_event_framework::Signal::SPtr> events) override
+    {
+        EnterBatch();
+        front_taken_ = false;
+        size_t processed = 0;
+        for (const auto& event : events)
+        {
+            Dispatch(event);
+            processed++;
+            if (front_taken_)
+            {
+                break;
+            }
+        }
+        LeaveBatch();
+        return processed;
     }
 
 protected:
     ActiveObjectBase() = default;
 
+    /**
+     * @brief Mark the calling thread as dispatching a batch of events, see Dispatch(std::span)
+     */
+    void EnterBatch()
+    {
+        batch_thread_.store(std::this_thread::get_id(), std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Batch dispatching finished
+     */
+    void LeaveBatch()
+    {
+        batch_thread_.store(std::thread::id(), std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Called when the object takes an event via TakeHighPrio() while dispatching a batch, from the
+     * dispatching thread. Default: Dispatch(std::span) returns after the current event.
+     */
+    virtual void OnTakeHighPrioInBatch()
+    {
+        front_taken_ = true;
+    }
+
+    /**
+     * @brief Arm a time event to be dispatched by this object, re-arms it when it is already armed.
+     * Must be called from the domain thread, e.g. from a statemachine entry action.
+     *
+     * @param event Time event
+     * @param delay Delay
+     * @param period Re-arm period after expiry, zero: one-shot
+     */
+    void ArmTimer(const TimeEvent::SPtr& event, TimerService::Clock::duration delay,
+                  TimerService::Clock::duration period = TimerService::Clock::duration::zero())
+    {
+        assert(timers_ != nullptr);
+        timers_->Arm(event, this, delay, period);
+    }
+
+    /**
+     * @brief Disarm a time event. Must be called from the domain thread, e.g. from a statemachine exit action.
+     *
+     * @param event Time event
+     * @return true Event was armed
+     */
+    bool DisarmTimer(TimeEvent& event)
+    {
+        assert(timers_ != nullptr);
+        return timers_->Disarm(event);
+    }
+
+    /**
+     * @brief Enqueue signals in front of all other entries of the queue, keeping their order
+     *
+     * @param events
+     */
+    void TakeHighPrio(std::span<const cpp_event_framework::Signal::SPtr> events)
+    {
+        assert(queue_ != nullptr);
+        if (!events.empty())
+        {
+            queue_->EnqueueFrontRange(this, events);
+        }
+    }
+
 private:
     IEventQueue* queue_ = nullptr;
+    TimerService* timers_ = nullptr;
+    // Thread running Dispatch(std::span), TakeHighPrio() of other threads is not ordered with the batch anyway
+    std::atomic<std::thread::id> batch_thread_;
+    bool front_taken_ = false;
+
+    void FrontEntryTaken()
+    {
+        if (batch_thread_.load(std::memory_order_relaxed) == std::this_thread::get_id())
+        {
+            OnTakeHighPrioInBatch();
+        }
+    }
 };
 } // namespace cpp_active_objects_embedded
@@ -10,8 +10,16 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <optional>
+#include <span>
+
 #include <cpp_active_objects_embedded/IActiveObjectDomain.hxx>
 #include <cpp_active_objects_embedded/IEventQueue.hxx>
+#include <cpp_active_objects_embedded/TimerService.hxx>
 #include <cpp_event_framework/Signal.hxx>
 
 namespace cpp_active_objects_embedded
@@ -23,6 +31,11 @@ namespace cpp_active_objects_embedded
 class ActiveObjectDomainBase : public IActiveObjectDomain
 {
 public:
+    /**
+     * @brief Max. number of entries dequeued at once by Run()
+     */
+    static constexpr size_t kDequeueBatchSize = 16;
+
     /**
      * @brief Assign an active object to this domain
      *
@@ -31,6 +44,7 @@ public:
     void RegisterObject(IActiveObject* active_object) final
     {
         active_object->SetQueue(queue_);
+        active_object->SetTimerService(&timers_);
     }
 
 protected:
@@ -44,19 +58,37 @@ protected:
     }
 
     /**
-     * @brief Dequeue and dispatch event queue entries
+     * @brief Dequeue and dispatch event queue entries in batches of up to kDequeueBatchSize entries,
+     * dispatch expired time events. Consecutive entries of a batch for the same target are passed to
+     * IActiveObject::Dispatch(std::span) in one call.
      *
      */
     void Run()
     {
+        std::array<IEventQueue::QueueEntry, kDequeueBatchSize> batch;
         while (true)
         {
-            const auto entry = queue_->Dequeue();
-            if (entry.target == nullptr)
+            timers_.Process();
+
+            // Zero entries: timeout - time event(s) due
+            const auto count = queue_->DequeueBatch(batch, timers_.NextExpiry());
+            size_t i = 0;
+            while (i < count)
             {
-                return;
+                const auto processed = DispatchEntries(std::span(batch).subspan(i, count - i));
+                if (processed == 0)
+                {
+                    return;
+                }
+                i += processed;
+
+                // Entries enqueued at the front while dispatching go before the remaining entries of the batch
+                // and before time events that expire meanwhile
+                if (!DispatchFrontEntries())
+                {
+                    return;
+                }
             }
-            entry.target->Dispatch(entry.event);
         }
     }
 
@@ -66,10 +98,91 @@ protected:
      */
     void Stop()
     {
-        queue_->EnqueueBack(nullptr, nullptr);
+        queue_->EnqueueBack(nullptr, cpp_event_framework::Signal::SPtr());
     }
 
 private:
     IEventQueue* queue_ = nullptr;
+    TimerService timers_;
+    // Events of a group of entries being dispatched, see DispatchEntries()
+    std::array<cpp_event_framework::Signal::SPtr, kDequeueBatchSize> group_events_;
+
+    bool DispatchFrontEntries()
+    {
+        while (auto entry = queue_->TryDequeueFront())
+        {
+            if (!DispatchEntry(*entry))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Dispatch the first entry together with the following entries for the same target, returns the number of
+    // dispatched entries (0: dummy entry that exits Run()). Undispatched entries are left in place.
+    size_t DispatchEntries(std::span<IEventQueue::QueueEntry> entries)
+    {
+        const auto size = GroupSize(entries);
+        if (size == 1)
+        {
+            const auto entry = std::move(entries.front());
+            return DispatchEntry(entry) ? 1 : 0;
+        }
+
+        for (size_t i = 0; i < size; i++)
+        {
+            group_events_.at(i) = std::move(entries[i].event);
+        }
+        const auto processed = entries.front().target->Dispatch(
+            std::span<const cpp_event_framework::Signal::SPtr>(group_events_.data(), size));
+        assert(processed > 0);
+        for (size_t i = processed; i < size; i++)
+        {
+            entries[i].event = std::move(group_events_.at(i));
+        }
+        std::ranges::fill(group_events_, nullptr);
+        for (size_t i = 0; i < processed; i++)
+        {
+            entries[i] = IEventQueue::QueueEntry();
+        }
+        return processed;
+    }
+
+    // Number of consecutive std::shared_ptr event entries for the same target, intrusive events and control
+    // entries are dispatched one by one
+    static size_t GroupSize(std::span<const IEventQueue::QueueEntry> entries)
+    {
+        const auto& first = entries.front();
+        if ((first.target == nullptr) || (first.event == nullptr))
+        {
+            return 1;
+        }
+
+        size_t size = 1;
+        while ((size < entries.size()) && (entries[size].event != nullptr) && (entries[size].target == first.target))
+        {
+            size++;
+        }
+        return size;
+    }
+
+    // Returns false for the dummy entry that exits Run()
+    static bool DispatchEntry(const IEventQueue::QueueEntry& entry)
+    {
+        if (entry.target == nullptr)
+        {
+            return false;
+        }
+        if (entry.intrusive_event != nullptr)
+        {
+            entry.target->Dispatch(entry.intrusive_event);
+        }
+        else
+        {
+            entry.target->Dispatch(entry.event);
+        }
+        return true;
+    }
 };
 } // namespace cpp_active_objects_embedded
@@ -10,10 +10,16 @@
 
 #pragma once
 
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstddef>
 #include <list>
 #include <memory_resource>
 #include <mutex>
+#include <optional>
 #include <semaphore>
+#include <span>
 
 #include <cpp_active_objects_embedded/IActiveObject.hxx>
 #include <cpp_active_objects_embedded/IEventQueue.hxx>
@@ -72,10 +78,65 @@ public:
         {
             std::scoped_lock lock(mutex_);
             queue_.emplace_front(target, std::move(event));
+            new_front_.fetch_add(1, std::memory_order_relaxed);
         }
         sem_.release();
     }
 
+    /**
+     * @brief Enqueue an intrusive event to be dispatched by a target
+     *
+     * @param target
+     * @param event
+     */
+    void EnqueueBack(IActiveObject* target, cpp_event_framework::RefCountedSignal<>::IPtr event) override
+    {
+        {
+            std::scoped_lock lock(mutex_);
+            queue_.emplace_back(target, nullptr, std::move(event));
+        }
+        sem_.release();
+    }
+
+    /**
+     * @brief Enqueue an intrusive event to be dispatched by a target
+     *
+     * @param target
+     * @param event
+     */
+    void EnqueueFront(IActiveObject* target, cpp_event_framework::RefCountedSignal<>::IPtr event) override
+    {
+        {
+            std::scoped_lock lock(mutex_);
+            queue_.emplace_front(target, nullptr, std::move(event));
+            new_front_.fetch_add(1, std::memory_order_relaxed);
+        }
+        sem_.release();
+    }
+
+    /**
+     * @brief Enqueue events in front of all other entries under one lock
+     *
+     * @param target
+     * @param events
+     */
+    void EnqueueFrontRange(IActiveObject* target, std::span<const cpp_event_framework::Signal::SPtr> events) override
+    {
+        {
+            std::scoped_lock lock(mutex_);
+            auto pos = queue_.begin();
+            for (const auto& event : events)
+            {
+                queue_.emplace(pos, target, event);
+            }
+            new_front_.fetch_add(events.size(), std::memory_order_relaxed);
+        }
+        for (size_t i = 0; i < events.size(); i++)
+        {
+            sem_.release();
+        }
+    }
+
     /**
      * @brief Dequeue an entry, possibly blocking until there is an entry in the queue
      *
@@ -83,18 +144,127 @@ public:
      */
     QueueEntry Dequeue() override
     {
-        sem_.acquire();
+        return *DequeueUntil(std::chrono::steady_clock::time_point::max());
+    }
+
+    /**
+     * @brief Dequeue an entry, blocking until there is an entry in the queue or the deadline has passed
+     * (SemaphoreType without try_acquire_until(): same as Dequeue())
+     *
+     * @param deadline
+     * @return std::optional<QueueEntry> Queue entry, empty on timeout
+     */
+    std::optional<QueueEntry> DequeueUntil(std::chrono::steady_clock::time_point deadline) override
+    {
+        while (Acquire(deadline))
+        {
+            std::scoped_lock lock(mutex_);
+            if (!queue_.empty())
+            {
+                return PopFrontLocked();
+            }
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Dequeue up to entries.size() entries with one wakeup and under one lock
+     *
+     * @param entries Buffer, must not be empty
+     * @param deadline time_point::max(): no timeout
+     * @return size_t Number of dequeued entries, 0 on timeout
+     */
+    size_t DequeueBatch(std::span<QueueEntry> entries, std::chrono::steady_clock::time_point deadline) override
+    {
+        assert(!entries.empty());
+        while (Acquire(deadline))
+        {
+            std::scoped_lock lock(mutex_);
+            size_t count = 0;
+            while (!queue_.empty() && (count < entries.size()))
+            {
+                entries[count++] = PopFrontLocked();
+            }
+            if (count == 0)
+            {
+                continue;
+            }
+
+            new_front_.store(0, std::memory_order_relaxed);
+            ConsumeCounts(count - 1);
+            return count;
+        }
+        return 0;
+    }
+
+    /**
+     * @brief Dequeue an entry enqueued at the front since the last DequeueBatch(), never blocks
+     *
+     * @return std::optional<QueueEntry> Queue entry, empty if there is none
+     */
+    std::optional<QueueEntry> TryDequeueFront() override
+    {
+        if (new_front_.load(std::memory_order_relaxed) == 0)
+        {
+            return std::nullopt;
+        }
 
         std::scoped_lock lock(mutex_);
-        auto result = std::move(queue_.front());
-        queue_.pop_front();
+        if (new_front_.load(std::memory_order_relaxed) == 0)
+        {
+            return std::nullopt;
+        }
+        auto result = PopFrontLocked();
+        ConsumeCounts(1);
         return result;
     }
 
 private:
     cpp_event_framework::StaticPool<NumEntries, sizeof(std::_List_node<QueueEntry>)> memory_pool_;
     std::list<QueueEntry, std::pmr::polymorphic_allocator<QueueEntry>> queue_;
+    // Number of entries at the head of queue_ that were enqueued at the front since the last DequeueBatch()
+    std::atomic<size_t> new_front_ = 0;
     SemaphoreType sem_{0};
     MutexType mutex_;
+
+    bool Acquire(std::chrono::steady_clock::time_point deadline)
+    {
+        if constexpr (cpp_event_framework::TimedSemaphore<SemaphoreType>)
+        {
+            if (deadline != std::chrono::steady_clock::time_point::max())
+            {
+                return sem_.try_acquire_until(deadline);
+            }
+        }
+        sem_.acquire();
+        return true;
+    }
+
+    // Semaphore counts of entries dequeued without Acquire(). Counts that cannot be consumed (producer has not
+    // released yet, SemaphoreType without try_acquire()) lead to a wakeup with an empty queue later.
+    void ConsumeCounts(size_t count)
+    {
+        if constexpr (cpp_event_framework::TryAcquireSemaphore<SemaphoreType>)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                if (!sem_.try_acquire())
+                {
+                    return;
+                }
+            }
+        }
+    }
+
+    QueueEntry PopFrontLocked()
+    {
+        auto result = std::move(queue_.front());
+        queue_.pop_front();
+        if (new_front_.load(std::memory_order_relaxed) != 0)
+        {
+            new_front_.fetch_sub(1, std::memory_order_relaxed);
+        }
+        return result;
+    }
 };
 } // namespace cpp_active_objects_embedded
@@ -10,8 +10,10 @@
 
 #pragma once
 
+#include <algorithm>
+#include <iterator>
 #include <memory>
-#include <ranges>
+#include <span>
 #include <vector>
 
 #include <cpp_active_objects_embedded/ActiveObjectBase.hxx>
@@ -22,7 +24,9 @@ namespace cpp_active_objects_embedded
 {
 /**
  * @brief Base class for a statemachine using active-object pattern
- * Supports deferred events.
+ * Supports deferred events. Deferred events are stored per deferring state, in deferral order.
+ * Recalling puts the events back to the front of the object's queue under one queue lock. With SpscEventQueue,
+ * all events recalled at once must fit into its FrontCapacity.
  *
  * @tparam Fsm Statemachine to aggregate
  */
@@ -38,7 +42,7 @@ public:
 
     Hsm()
     {
-        fsm_.on_defer_event_ = [this](Fsm::StateRef, Fsm::Event event) { DeferEvent(event); };
+        fsm_.on_defer_event_ = [this](Fsm::StateRef state, Fsm::Event event) { DeferEvent(state, event); };
         fsm_.on_recall_deferred_events_ = [this](Fsm::StateRef) { RecallEvents(); };
     }
 
@@ -52,6 +56,22 @@ public:
         fsm_.React(event);
     }
 
+    /**
+     * @brief Dispatch consecutive queue entries in active object domain.
+     * Returns after an event that recalled deferred events or took an event via TakeHighPrio(), the caller
+     * processes these before the remaining ones. Statemachine hooks still fire per event.
+     *
+     * @param events
+     * @return size_t Number of dispatched events
+     */
+    size_t Dispatch(std::span<const cpp_event_framework::Signal::SPtr> events) override
+    {
+        EnterBatch();
+        const auto processed = fsm_.React(events);
+        LeaveBatch();
+        return processed;
+    }
+
 protected:
     /**
      * @brief Statemachine
@@ -59,21 +79,74 @@ protected:
      */
     Fsm fsm_;
 
+    /**
+     * @brief Events taken via TakeHighPrio() while dispatching a batch go before its remaining events
+     */
+    void OnTakeHighPrioInBatch() override
+    {
+        fsm_.StopReact();
+    }
+
+    /**
+     * @brief Recall only the events deferred by one state. fsm_.RecallEvents() recalls the events of all states,
+     * group by group in the order the groups were created.
+     *
+     * @param state Deferring state
+     */
+    void RecallEvents(Fsm::StateRef state)
+    {
+        recall_state_ = &state;
+        fsm_.RecallEvents();
+        recall_state_ = nullptr;
+    }
+
+    /**
+     * @brief Number of events deferred by a state
+     *
+     * @param state Deferring state
+     * @return size_t
+     */
+    [[nodiscard]] size_t NumDeferredEvents(Fsm::StateRef state) const
+    {
+        const auto group = std::ranges::find(deferred_groups_, &state, &DeferredGroup::state);
+        return (group != deferred_groups_.end()) ? group->events.size() : 0;
+    }
+
 private:
-    std::vector<cpp_event_framework::Signal::SPtr> deferred_events_;
+    struct DeferredGroup
+    {
+        Fsm::StatePtr state;
+        std::vector<cpp_event_framework::Signal::SPtr> events;
+    };
 
-    void DeferEvent(Fsm::Event event)
+    // One group per state that ever deferred an event, groups are kept to reuse their memory
+    std::vector<DeferredGroup> deferred_groups_;
+    std::vector<cpp_event_framework::Signal::SPtr> recalled_events_;
+    Fsm::StatePtr recall_state_ = nullptr;
+
+    void DeferEvent(Fsm::StateRef state, Fsm::Event event)
     {
-        deferred_events_.emplace_back(event);
+        auto group = std::ranges::find(deferred_groups_, &state, &DeferredGroup::state);
+        if (group == deferred_groups_.end())
+        {
+            group = deferred_groups_.insert(deferred_groups_.end(), DeferredGroup{&state, {}});
+        }
+        group->events.emplace_back(event);
     }
 
     void RecallEvents()
     {
-        for (const auto& event : std::ranges::reverse_view(deferred_events_))
+        for (auto& group : deferred_groups_)
         {
-            TakeHighPrio(event);
+            if ((recall_state_ == nullptr) || (group.state == recall_state_))
+            {
+                recalled_events_.insert(recalled_events_.end(), std::make_move_iterator(group.events.begin()),
+                                        std::make_move_iterator(group.events.end()));
+                group.events.clear();
+            }
         }
-        deferred_events_.clear();
+        TakeHighPrio(recalled_events_);
+        recalled_events_.clear();
     }
 };
 } // namespace cpp_active_objects_embedded
@@ -10,12 +10,16 @@
 
 #pragma once
 
+#include <cstddef>
+#include <span>
+
 #include <cpp_active_objects_embedded/IEventTarget.hxx>
 #include <cpp_event_framework/Signal.hxx>
 
 namespace cpp_active_objects_embedded
 {
 class IEventQueue;
+class TimerService;
 
 /**
  * @brief Interface of an active object
@@ -34,11 +38,51 @@ public:
      */
     virtual void SetQueue(IEventQueue* queue) = 0;
 
+    /**
+     * @brief Set the timer service of the domain the object is registered in.
+     * Default: ignore, for objects that do not use time events.
+     *
+     * @param timers Timer service, nullptr if the domain has none
+     */
+    virtual void SetTimerService(TimerService* /*timers*/)
+    {
+    }
+
     /**
      * @brief Dispatch event in active object domain
      *
      * @param event
      */
     virtual void Dispatch(const cpp_event_framework::Signal::SPtr& event) = 0;
+
+    /**
+     * @brief Dispatch intrusive reference counted event in active object domain.
+     * Default: forward to Dispatch(const Signal::SPtr&). The std::shared_ptr holds an intrusive reference, but its
+     * control block is allocated on the heap - objects taking intrusive events frequently should override this.
+     *
+     * @param event
+     */
+    virtual void Dispatch(const cpp_event_framework::RefCountedSignal<>::IPtr& event)
+    {
+        Dispatch(cpp_event_framework::RefCountedSignal<>::SharedFromIntrusive(event));
+    }
+
+    /**
+     * @brief Dispatch consecutive queue entries for this object in one call.
+     * Events taken via TakeHighPrio() during the call must be processed before the remaining events: the object
+     * returns after the event that took them, the caller dispatches the entries at the front of the queue and
+     * passes the remaining events again. Default: dispatch all one by one, see ActiveObjectBase.
+     *
+     * @param events
+     * @return size_t Number of dispatched events, at least one
+     */
+    virtual size_t Dispatch(std::span<const cpp_event_framework::Signal::SPtr> events)
+    {
+        for (const auto& event : events)
+        {
+            Dispatch(event);
+        }
+        return events.size();
+    }
 };
 } // namespace cpp_active_objects_embedded
@@ -10,6 +10,13 @@
 
 #pragma once
 
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <optional>
+#include <ranges>
+#include <span>
+
 #include <cpp_event_framework/Signal.hxx>
 
 namespace cpp_active_objects_embedded
@@ -36,6 +43,10 @@ public:
          * @brief Event
          */
         cpp_event_framework::Signal::SPtr event;
+        /**
+         * @brief Intrusive reference counted event, set instead of event (no shared_ptr control block)
+         */
+        cpp_event_framework::RefCountedSignal<>::IPtr intrusive_event = nullptr;
     };
 
     /**
@@ -60,11 +71,110 @@ public:
      */
     virtual void EnqueueFront(IActiveObject* target, cpp_event_framework::Signal::SPtr event) = 0;
 
+    /**
+     * @brief Enqueue an intrusive event to be dispatched by a target.
+     * Default: enqueue it as Signal::SPtr (see RefCountedSignal::SharedFromIntrusive()).
+     *
+     * @param target
+     * @param event
+     */
+    virtual void EnqueueBack(IActiveObject* target, cpp_event_framework::RefCountedSignal<>::IPtr event)
+    {
+        EnqueueBack(target, cpp_event_framework::RefCountedSignal<>::SharedFromIntrusive(event));
+    }
+
+    /**
+     * @brief Enqueue an intrusive event to be dispatched by a target.
+     * Default: enqueue it as Signal::SPtr (see RefCountedSignal::SharedFromIntrusive()).
+     *
+     * @param target
+     * @param event
+     */
+    virtual void EnqueueFront(IActiveObject* target, cpp_event_framework::RefCountedSignal<>::IPtr event)
+    {
+        EnqueueFront(target, cpp_event_framework::RefCountedSignal<>::SharedFromIntrusive(event));
+    }
+
+    /**
+     * @brief Enqueue an event with an explicit priority instead of the signal's Priority().
+     * Default: queues without priority levels ignore the priority.
+     *
+     * @param target
+     * @param event
+     * @param priority
+     */
+    virtual void EnqueueBack(IActiveObject* target, cpp_event_framework::Signal::SPtr event,
+                             cpp_event_framework::Signal::PriorityType /*priority*/)
+    {
+        EnqueueBack(target, std::move(event));
+    }
+
+    /**
+     * @brief Enqueue events in front of all other entries, keeping their order (first event is dequeued first).
+     * The default implementation calls EnqueueFront() per event, EventQueue inserts all of them under one lock.
+     *
+     * @param target
+     * @param events
+     */
+    virtual void EnqueueFrontRange(IActiveObject* target, std::span<const cpp_event_framework::Signal::SPtr> events)
+    {
+        for (const auto& event : std::ranges::reverse_view(events))
+        {
+            EnqueueFront(target, event);
+        }
+    }
+
     /**
      * @brief Dequeue an ActiveObject-Event pair
      *
      * @return std::pair<std::shared_ptr<IActiveObject>, Signal::SPtr>
      */
     virtual QueueEntry Dequeue() = 0;
+
+    /**
+     * @brief Dequeue an entry, blocking until there is an entry in the queue or the deadline has passed.
+     * Default: blocks like Dequeue() - queues that cannot wait with a deadline delay timers until the next entry.
+     *
+     * @param deadline
+     * @return std::optional<QueueEntry> Queue entry, empty on timeout
+     */
+    virtual std::optional<QueueEntry> DequeueUntil(std::chrono::steady_clock::time_point /*deadline*/)
+    {
+        return Dequeue();
+    }
+
+    /**
+     * @brief Dequeue up to entries.size() entries, blocking until there is at least one entry in the queue or the
+     * deadline has passed. Entries enqueued at the front while the batch is being dispatched are returned by
+     * TryDequeueFront(), the consumer must dispatch them before the remaining batch entries.
+     * Default: dequeues one entry via Dequeue() / DequeueUntil().
+     *
+     * @param entries Buffer, must not be empty
+     * @param deadline time_point::max(): no timeout
+     * @return size_t Number of dequeued entries, 0 on timeout
+     */
+    virtual size_t DequeueBatch(std::span<QueueEntry> entries, std::chrono::steady_clock::time_point deadline)
+    {
+        assert(!entries.empty());
+        auto entry = (deadline == std::chrono::steady_clock::time_point::max()) ? std::optional(Dequeue())
+                                                                                  : DequeueUntil(deadline);
+        if (!entry.has_value())
+        {
+            return 0;
+        }
+        entries.front() = std::move(*entry);
+        return 1;
+    }
+
+    /**
+     * @brief Dequeue an entry enqueued at the front since the last DequeueBatch(), never blocks.
+     * Default: none - the default DequeueBatch() only returns single entries.
+     *
+     * @return std::optional<QueueEntry> Queue entry, empty if there is none
+     */
+    virtual std::optional<QueueEntry> TryDequeueFront()
+    {
+        return std::nullopt;
+    }
 };
 } // namespace cpp_active_objects_embedded
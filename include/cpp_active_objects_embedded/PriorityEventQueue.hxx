@@ -0,0 +1,227 @@
+/**
+ * @file PriorityEventQueue.hxx
+ * @author Dirk Ziegelmeier (dirk@ziegelmeier.net)
+ * @brief
+ * @date 16-10-2026
+ *
+ * @copyright SPDX-License-Identifier: Apache-2.0
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory_resource>
+#include <mutex>
+#include <optional>
+#include <semaphore>
+#include <utility>
+
+#include <cpp_active_objects_embedded/IActiveObject.hxx>
+#include <cpp_active_objects_embedded/IEventQueue.hxx>
+#include <cpp_event_framework/Concepts.hxx>
+#include <cpp_event_framework/Signal.hxx>
+#include <cpp_event_framework/StaticPool.hxx>
+
+namespace cpp_active_objects_embedded
+{
+/**
+ * @brief A thread-safe event queue with NumLevels priority levels: one FIFO per level and a bitmap of non-empty
+ * levels, enqueue and dequeue are O(1). Dequeue takes the oldest entry of the highest non-empty level.
+ * The level of an entry is the signal's Priority() or the priority passed to EnqueueBack(), clamped to
+ * NumLevels - 1. EnqueueFront() enqueues in front of the entry's own level, i.e. TakeHighPrio() never overtakes
+ * entries of higher levels. Stop requests are enqueued in the highest level, i.e. before pending entries of
+ * lower levels. All levels share one static pool.
+ *
+ * @tparam NumEntries Max. number of entries in all levels
+ * @tparam NumLevels Number of priority levels, 1..32
+ * @tparam SemaphoreType Sempahore type to use - e.g. to be able to supply own RT-capable implementation
+ *         NamedRequirements: DefaultConstructible. No named requirements for release() and acquire() available.
+ * @tparam MutexType Mutex type to use - e.g. to be able to supply own RT-capable implementation
+ *         NamedRequirements: DefaultConstructible, Destructible, BasicLockable
+ */
+template <size_t NumEntries, size_t NumLevels = 4,
+          cpp_event_framework::Semaphore SemaphoreType = std::counting_semaphore<>,
+          cpp_event_framework::Mutex MutexType = std::mutex>
+class PriorityEventQueue final : public IEventQueue
+{
+    static_assert((NumLevels >= 1) && (NumLevels <= 32), "NumLevels must be 1..32");
+
+public:
+    PriorityEventQueue()
+        : memory_pool_("PriorityEventQueue"), levels_(MakeLevels(&memory_pool_, std::make_index_sequence<NumLevels>{}))
+    {
+    }
+
+    ~PriorityEventQueue() = default;
+
+    // Non-copyable, non-movable
+    PriorityEventQueue(const PriorityEventQueue& rhs) = delete;
+    PriorityEventQueue(PriorityEventQueue&& rhs) = delete;
+    PriorityEventQueue& operator=(const PriorityEventQueue& rhs) = delete;
+    PriorityEventQueue& operator=(PriorityEventQueue&& rhs) = delete;
+
+    /**
+     * @brief Enqueue an event to be dispatched by a target, at the back of the event's priority level
+     *
+     * @param target
+     * @param event
+     */
+    void EnqueueBack(IActiveObject* target, cpp_event_framework::Signal::SPtr event) override
+    {
+        const auto level = LevelOf(event.get());
+        PushBack(level, QueueEntry{target, std::move(event)});
+    }
+
+    /**
+     * @brief Enqueue an event to be dispatched by a target, at the front of the event's priority level
+     *
+     * @param target
+     * @param event
+     */
+    void EnqueueFront(IActiveObject* target, cpp_event_framework::Signal::SPtr event) override
+    {
+        const auto level = LevelOf(event.get());
+        PushFront(level, QueueEntry{target, std::move(event)});
+    }
+
+    /**
+     * @brief Enqueue an intrusive event to be dispatched by a target, at the back of the event's priority level
+     *
+     * @param target
+     * @param event
+     */
+    void EnqueueBack(IActiveObject* target, cpp_event_framework::RefCountedSignal<>::IPtr event) override
+    {
+        const auto level = LevelOf(event.get());
+        PushBack(level, QueueEntry{target, nullptr, std::move(event)});
+    }
+
+    /**
+     * @brief Enqueue an intrusive event to be dispatched by a target, at the front of the event's priority level
+     *
+     * @param target
+     * @param event
+     */
+    void EnqueueFront(IActiveObject* target, cpp_event_framework::RefCountedSignal<>::IPtr event) override
+    {
+        const auto level = LevelOf(event.get());
+        PushFront(level, QueueEntry{target, nullptr, std::move(event)});
+    }
+
+    /**
+     * @brief Enqueue an event to be dispatched by a target, at the back of the given priority level
+     *
+     * @param target
+     * @param event
+     * @param priority
+     */
+    void EnqueueBack(IActiveObject* target, cpp_event_framework::Signal::SPtr event,
+                     cpp_event_framework::Signal::PriorityType priority) override
+    {
+        PushBack(Clamp(priority), QueueEntry{target, std::move(event)});
+    }
+
+    /**
+     * @brief Dequeue an entry, possibly blocking until there is an entry in the queue
+     *
+     * @return QueueEntry Queue entry
+     */
+    QueueEntry Dequeue() override
+    {
+        sem_.acquire();
+        return PopHighest();
+    }
+
+    /**
+     * @brief Dequeue an entry, blocking until there is an entry in the queue or the deadline has passed
+     * (SemaphoreType without try_acquire_until(): same as Dequeue())
+     *
+     * @param deadline
+     * @return std::optional<QueueEntry> Queue entry, empty on timeout
+     */
+    std::optional<QueueEntry> DequeueUntil(std::chrono::steady_clock::time_point deadline) override
+    {
+        if constexpr (cpp_event_framework::TimedSemaphore<SemaphoreType>)
+        {
+            if (!sem_.try_acquire_until(deadline))
+            {
+                return std::nullopt;
+            }
+        }
+        else
+        {
+            sem_.acquire();
+        }
+        return PopHighest();
+    }
+
+private:
+    using LevelList = std::list<QueueEntry, std::pmr::polymorphic_allocator<QueueEntry>>;
+
+    cpp_event_framework::StaticPool<NumEntries, sizeof(std::_List_node<QueueEntry>)> memory_pool_;
+    std::array<LevelList, NumLevels> levels_;
+    // Bit n set: levels_[n] is not empty
+    uint32_t occupied_ = 0;
+    SemaphoreType sem_{0};
+    MutexType mutex_;
+
+    template <size_t... Levels>
+    static std::array<LevelList, NumLevels> MakeLevels(std::pmr::memory_resource* resource,
+                                                       std::index_sequence<Levels...> /*levels*/)
+    {
+        return {((void)Levels, LevelList(resource))...};
+    }
+
+    static size_t Clamp(cpp_event_framework::Signal::PriorityType priority)
+    {
+        return std::min(static_cast<size_t>(priority), NumLevels - 1);
+    }
+
+    static size_t LevelOf(const cpp_event_framework::Signal* event)
+    {
+        // No event: control entry, see class description
+        return (event != nullptr) ? Clamp(event->Priority()) : NumLevels - 1;
+    }
+
+    void PushBack(size_t level, QueueEntry entry)
+    {
+        {
+            std::scoped_lock lock(mutex_);
+            levels_.at(level).emplace_back(std::move(entry));
+            occupied_ |= (1U << level);
+        }
+        sem_.release();
+    }
+
+    void PushFront(size_t level, QueueEntry entry)
+    {
+        {
+            std::scoped_lock lock(mutex_);
+            levels_.at(level).emplace_front(std::move(entry));
+            occupied_ |= (1U << level);
+        }
+        sem_.release();
+    }
+
+    QueueEntry PopHighest()
+    {
+        std::scoped_lock lock(mutex_);
+        const auto level = static_cast<size_t>(std::bit_width(occupied_)) - 1;
+        auto& queue = levels_.at(level);
+        auto result = std::move(queue.front());
+        queue.pop_front();
+        if (queue.empty())
+        {
+            occupied_ &= ~(1U << level);
+        }
+        return result;
+    }
+};
+} // namespace cpp_active_objects_embedded
@@ -0,0 +1,249 @@
+/**
+ * @file SpscEventQueue.hxx
+ * @author Dirk Ziegelmeier (dirk@ziegelmeier.net)
+ * @brief
+ * @date 16-10-2026
+ *
+ * @copyright SPDX-License-Identifier: Apache-2.0
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <optional>
+#include <ranges>
+#include <semaphore>
+#include <span>
+#include <thread>
+
+#include <cpp_active_objects_embedded/IActiveObject.hxx>
+#include <cpp_active_objects_embedded/IEventQueue.hxx>
+#include <cpp_event_framework/Concepts.hxx>
+#include <cpp_event_framework/Signal.hxx>
+#include <cpp_event_framework/SpscRing.hxx>
+
+namespace cpp_active_objects_embedded
+{
+/**
+ * @brief A lock-free, heap-free bounded single-producer/single-consumer event queue
+ * EnqueueBack() must only be called from ONE producer thread, Dequeue() from ONE consumer thread (the domain
+ * thread). EnqueueFront() and EnqueueFrontRange() must only be called from the consumer thread, e.g. by Hsm when
+ * recalling deferred events from a dispatch. Front entries are dispatched before back entries, the most recent one
+ * first, EnqueueFrontRange() keeps the order of its events.
+ * Front entries are bounded by FrontCapacity, choose it at least as large as the number of events objects in the
+ * domain may defer at the same time plus their TakeHighPrio() events: recalling more events asserts, a non-aborting
+ * AssertionProvider drops them.
+ * EnqueueFront() asserts the calling thread once the consumer has started dequeuing, i.e. TakeHighPrio() of objects
+ * in a domain using this queue is restricted to the domain thread.
+ * Note the domain's Stop() also enqueues (back) - destroy the domain only when the producer is done.
+ *
+ * @tparam Capacity Max. number of EnqueueBack() entries
+ * @tparam FullPolicy What to do when EnqueueBack() finds the queue full
+ * @tparam FrontCapacity Max. number of front entries, see EnqueueFront() and EnqueueFrontRange()
+ * @tparam SemaphoreType Sempahore type to use - e.g. to be able to supply own RT-capable implementation
+ */
+template <size_t Capacity,
+          cpp_event_framework::EQueueFullPolicy FullPolicy = cpp_event_framework::EQueueFullPolicy::kAssert,
+          size_t FrontCapacity = 16, cpp_event_framework::Semaphore SemaphoreType = std::counting_semaphore<>,
+          cpp_event_framework::AssertionProvider AssertionProviderType = cpp_event_framework::DefaultAssertionProvider>
+class SpscEventQueue final : public IEventQueue
+{
+public:
+    SpscEventQueue() = default;
+    ~SpscEventQueue() override = default;
+
+    // Non-copyable, non-movable
+    SpscEventQueue(const SpscEventQueue& rhs) = delete;
+    SpscEventQueue(SpscEventQueue&& rhs) = delete;
+    SpscEventQueue& operator=(const SpscEventQueue& rhs) = delete;
+    SpscEventQueue& operator=(SpscEventQueue&& rhs) = delete;
+
+    /**
+     * @brief Enqueue an event to be dispatched by a target (producer thread only)
+     *
+     * @param target
+     * @param event
+     */
+    void EnqueueBack(IActiveObject* target, cpp_event_framework::Signal::SPtr event) override
+    {
+        PushBack(QueueEntry{target, std::move(event)});
+    }
+
+    /**
+     * @brief Enqueue an event to be dispatched by a target (consumer thread only)
+     *
+     * @param target
+     * @param event
+     */
+    void EnqueueFront(IActiveObject* target, cpp_event_framework::Signal::SPtr event) override
+    {
+        PushFront(QueueEntry{target, std::move(event)});
+    }
+
+    /**
+     * @brief Enqueue an intrusive event to be dispatched by a target (producer thread only)
+     *
+     * @param target
+     * @param event
+     */
+    void EnqueueBack(IActiveObject* target, cpp_event_framework::RefCountedSignal<>::IPtr event) override
+    {
+        PushBack(QueueEntry{target, nullptr, std::move(event)});
+    }
+
+    /**
+     * @brief Enqueue an intrusive event to be dispatched by a target (consumer thread only)
+     *
+     * @param target
+     * @param event
+     */
+    void EnqueueFront(IActiveObject* target, cpp_event_framework::RefCountedSignal<>::IPtr event) override
+    {
+        PushFront(QueueEntry{target, nullptr, std::move(event)});
+    }
+
+    /**
+     * @brief Enqueue events in front of all other entries, keeping their order (consumer thread only).
+     * All events are enqueued or, when they do not fit into FrontCapacity, none.
+     *
+     * @param target
+     * @param events
+     */
+    void EnqueueFrontRange(IActiveObject* target, std::span<const cpp_event_framework::Signal::SPtr> events) override
+    {
+        AssertionProviderType::Assert(IsConsumerThread());
+        if (events.size() > (FrontCapacity - front_count_))
+        {
+            AssertionProviderType::Assert(false);
+            return;
+        }
+
+        // Front entries are a stack: last event first
+        for (const auto& event : std::ranges::reverse_view(events))
+        {
+            front_.at(front_count_++) = QueueEntry{target, event};
+        }
+        for (size_t i = 0; i < events.size(); i++)
+        {
+            sem_.release();
+        }
+    }
+
+    /**
+     * @brief Dequeue an entry, possibly blocking until there is an entry in the queue
+     *
+     * @return QueueEntry Queue entry
+     */
+    QueueEntry Dequeue() override
+    {
+        consumer_.store(std::this_thread::get_id(), std::memory_order_relaxed);
+        sem_.acquire();
+        return PopAcquired();
+    }
+
+    /**
+     * @brief Dequeue an entry, blocking until there is an entry in the queue or the deadline has passed
+     * (SemaphoreType without try_acquire_until(): same as Dequeue())
+     *
+     * @param deadline
+     * @return std::optional<QueueEntry> Queue entry, empty on timeout
+     */
+    std::optional<QueueEntry> DequeueUntil(std::chrono::steady_clock::time_point deadline) override
+    {
+        consumer_.store(std::this_thread::get_id(), std::memory_order_relaxed);
+        if constexpr (cpp_event_framework::TimedSemaphore<SemaphoreType>)
+        {
+            if (!sem_.try_acquire_until(deadline))
+            {
+                return std::nullopt;
+            }
+        }
+        else
+        {
+            sem_.acquire();
+        }
+        return PopAcquired();
+    }
+
+    /**
+     * @brief Number of entries discarded because the queue was full (EQueueFullPolicy::kDrop)
+     *
+     * @return size_t
+     */
+    [[nodiscard]] size_t Dropped() const
+    {
+        return dropped_.load(std::memory_order_relaxed);
+    }
+
+private:
+    cpp_event_framework::SpscRing<QueueEntry, Capacity> ring_;
+    std::array<QueueEntry, FrontCapacity> front_ = {};
+    size_t front_count_ = 0;
+    std::atomic<size_t> dropped_ = 0;
+    SemaphoreType sem_{0};
+    // Thread that called Dequeue() last, default-constructed until then
+    std::atomic<std::thread::id> consumer_;
+
+    [[nodiscard]] bool IsConsumerThread() const
+    {
+        const auto consumer = consumer_.load(std::memory_order_relaxed);
+        return (consumer == std::thread::id()) || (consumer == std::this_thread::get_id());
+    }
+
+    void PushBack(QueueEntry entry)
+    {
+        while (!ring_.TryPush(entry))
+        {
+            if constexpr (FullPolicy == cpp_event_framework::EQueueFullPolicy::kAssert)
+            {
+                AssertionProviderType::Assert(false);
+                return;
+            }
+            else if constexpr (FullPolicy == cpp_event_framework::EQueueFullPolicy::kDrop)
+            {
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+        sem_.release();
+    }
+
+    void PushFront(QueueEntry entry)
+    {
+        AssertionProviderType::Assert(IsConsumerThread());
+        if (front_count_ == FrontCapacity)
+        {
+            AssertionProviderType::Assert(false);
+            return;
+        }
+        front_.at(front_count_++) = std::move(entry);
+        sem_.release();
+    }
+
+    // Semaphore has been acquired, an entry is available
+    QueueEntry PopAcquired()
+    {
+        QueueEntry result;
+        if (front_count_ != 0)
+        {
+            result = std::move(front_.at(--front_count_));
+            front_.at(front_count_) = QueueEntry();
+        }
+        else
+        {
+            // Producer pushes before releasing the semaphore, so pop cannot fail
+            [[maybe_unused]] auto ok = ring_.TryPop(result);
+            AssertionProviderType::Assert(ok);
+        }
+        return result;
+    }
+};
+} // namespace cpp_active_objects_embedded
@@ -0,0 +1,219 @@
+/**
+ * @file TimerService.hxx
+ * @author Dirk Ziegelmeier (dirk@ziegelmeier.net)
+ * @brief
+ * @date 16-10-2026
+ *
+ * @copyright SPDX-License-Identifier: Apache-2.0
+ *
+ */
+
+#pragma once
+
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <cpp_active_objects_embedded/IActiveObject.hxx>
+#include <cpp_event_framework/Signal.hxx>
+#include <cpp_event_framework/TimingWheel.hxx>
+
+namespace cpp_active_objects_embedded
+{
+class TimerService;
+
+/**
+ * @brief Base class for time event signals. Use it as signal base class, e.g.
+ * class Timeout
+ *     : public cpp_event_framework::NextSignal<Timeout, PreviousSignal, cpp_active_objects_embedded::TimeEvent>
+ * Time events are created once (from the signal's allocator, e.g. a pool) and armed/disarmed as often as needed,
+ * arming never allocates. While armed, the timer service holds a reference to the event.
+ */
+class TimeEvent : public cpp_event_framework::Signal, private cpp_event_framework::TimingWheelNode
+{
+public:
+    /**
+     * @brief Shared pointer alias
+     *
+     */
+    using SPtr = std::shared_ptr<TimeEvent>;
+
+    using cpp_event_framework::TimingWheelNode::IsArmed;
+
+protected:
+    /**
+     * @brief Constructor
+     *
+     * @param signal_id Signal ID
+     */
+    explicit TimeEvent(IdType signal_id) : Signal(signal_id)
+    {
+    }
+
+private:
+    friend class TimerService;
+
+    cpp_event_framework::Signal::SPtr self_;
+    IActiveObject* target_ = nullptr;
+    uint64_t period_ = 0;
+};
+
+/**
+ * @brief Timer service of an active object domain, based on a hierarchical timing wheel.
+ * Expired time events are dispatched directly to their target from the domain thread (no queue hop).
+ * Not thread-safe: Arm()/Disarm() must be called from the domain thread, e.g. from statemachine actions of
+ * objects registered in the domain.
+ */
+class TimerService
+{
+public:
+    /**
+     * @brief Clock type
+     */
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Construct a new timer service
+     *
+     * @param tick Timer resolution
+     */
+    explicit TimerService(Clock::duration tick = std::chrono::milliseconds(1)) : tick_(tick), epoch_(Clock::now())
+    {
+    }
+
+    ~TimerService()
+    {
+        wheel_.Clear([](cpp_event_framework::TimingWheelNode& node) { Release(static_cast<TimeEvent&>(node)); });
+    }
+
+    // Non-copyable, non-movable
+    TimerService(const TimerService& rhs) = delete;
+    TimerService(TimerService&& rhs) = delete;
+    TimerService& operator=(const TimerService& rhs) = delete;
+    TimerService& operator=(TimerService&& rhs) = delete;
+
+    /**
+     * @brief Arm a time event, re-arms it when it is already armed
+     *
+     * @param event Time event
+     * @param target Object to dispatch event to when it expires
+     * @param delay Delay, rounded up to timer resolution
+     * @param period Re-arm period after expiry, zero: one-shot
+     */
+    void Arm(const TimeEvent::SPtr& event, IActiveObject* target, Clock::duration delay,
+             Clock::duration period = Clock::duration::zero())
+    {
+        assert(event != nullptr);
+        assert(target != nullptr);
+
+        event->self_ = event;
+        event->target_ = target;
+        event->period_ = (period > Clock::duration::zero()) ? Ticks(period) : 0;
+
+        // Expiry relative to current time, wheel time may lag behind
+        const uint64_t expiry = Ticks((Clock::now() - epoch_) + delay);
+        wheel_.Arm(*event, (expiry > wheel_.Now()) ? (expiry - wheel_.Now()) : 1);
+    }
+
+    /**
+     * @brief Disarm a time event
+     *
+     * @param event Time event
+     * @return true Event was armed
+     */
+    bool Disarm(TimeEvent& event)
+    {
+        if (!wheel_.Cancel(event))
+        {
+            return false;
+        }
+        Release(event);
+        return true;
+    }
+
+    /**
+     * @brief Check whether no time event is armed
+     */
+    [[nodiscard]] bool Empty() const
+    {
+        return wheel_.Empty();
+    }
+
+    /**
+     * @brief Number of armed time events
+     */
+    [[nodiscard]] size_t Size() const
+    {
+        return wheel_.Size();
+    }
+
+    /**
+     * @brief Time when Process() has work to do next, never later than the earliest expiry
+     *
+     * @return Clock::time_point Clock::time_point::max() when no event is armed
+     */
+    [[nodiscard]] Clock::time_point NextExpiry() const
+    {
+        const auto tick = wheel_.NextEventTick();
+        if (tick == Wheel::kNever)
+        {
+            return Clock::time_point::max();
+        }
+        return epoch_ + (tick_ * static_cast<Clock::rep>(tick));
+    }
+
+    /**
+     * @brief Dispatch all expired time events
+     *
+     * @return size_t Number of dispatched events
+     */
+    size_t Process()
+    {
+        if (wheel_.Empty())
+        {
+            return 0;
+        }
+
+        const auto now = static_cast<uint64_t>((Clock::now() - epoch_) / tick_);
+        return wheel_.Advance(now,
+                              [this](cpp_event_framework::TimingWheelNode& node)
+                              {
+                                  auto& event = static_cast<TimeEvent&>(node);
+                                  if (event.period_ != 0)
+                                  {
+                                      wheel_.Arm(event, event.period_);
+                                      auto signal = event.self_;
+                                      event.target_->Dispatch(signal);
+                                  }
+                                  else
+                                  {
+                                      auto* target = event.target_;
+                                      auto signal = std::move(event.self_);
+                                      target->Dispatch(signal);
+                                  }
+                              });
+    }
+
+private:
+    using Wheel = cpp_event_framework::TimingWheel<>;
+
+    Clock::duration tick_;
+    Clock::time_point epoch_;
+    Wheel wheel_;
+
+    // Round up to ticks
+    [[nodiscard]] uint64_t Ticks(Clock::duration duration) const
+    {
+        return static_cast<uint64_t>((duration + tick_ - Clock::duration(1)) / tick_);
+    }
+
+    static void Release(TimeEvent& event)
+    {
+        // Event may be destroyed when the last reference is dropped
+        auto signal = std::move(event.self_);
+        event.target_ = nullptr;
+    }
+};
+} // namespace cpp_active_objects_embedded
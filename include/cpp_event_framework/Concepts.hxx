@@ -11,6 +11,8 @@
 #pragma once
 
 #include <cassert>
+#include <chrono>
+#include <concepts>
 #include <cstddef>
 #include <memory_resource>
 #include <type_traits>
@@ -35,6 +37,22 @@ concept Semaphore = std::is_constructible_v<T, std::ptrdiff_t> && std::is_destru
     { a.release() };
 };
 
+/**
+ * @brief Concept for semaphore that supports waiting with a deadline (e.g. std::counting_semaphore)
+ */
+template <typename T>
+concept TimedSemaphore = Semaphore<T> && requires(T a, std::chrono::steady_clock::time_point deadline) {
+    { a.try_acquire_until(deadline) } -> std::convertible_to<bool>;
+};
+
+/**
+ * @brief Concept for semaphore that supports acquiring without blocking (e.g. std::counting_semaphore)
+ */
+template <typename T>
+concept TryAcquireSemaphore = Semaphore<T> && requires(T a) {
+    { a.try_acquire() } -> std::convertible_to<bool>;
+};
+
 /**
  * @brief Concept for assertion function
  */
@@ -0,0 +1,193 @@
+/**
+ * @file IntrusivePtr.hxx
+ * @author Dirk Ziegelmeier (dirk@ziegelmeier.net)
+ * @brief
+ * @date 16-10-2026
+ *
+ * @copyright SPDX-License-Identifier: Apache-2.0
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace cpp_event_framework
+{
+/**
+ * @brief Smart pointer to an object with embedded reference count (e.g. a signal derived from RefCountedSignal).
+ * Same size as a raw pointer, no separate control block. Interface follows std::shared_ptr so it can be used
+ * in the same places, e.g. as Statemachine EventType.
+ *
+ * @tparam T Pointee type, must provide AddRef() and Release()
+ */
+template <typename T>
+class IntrusivePtr
+{
+public:
+    /**
+     * @brief Element type
+     */
+    using element_type = T;
+
+    IntrusivePtr() = default;
+
+    /**
+     * @brief Construct empty pointer
+     */
+    IntrusivePtr(std::nullptr_t)
+    {
+    }
+
+    /**
+     * @brief Construct from raw pointer
+     *
+     * @param ptr Object pointer
+     * @param add_ref false: adopt a reference that is already held (no increment)
+     */
+    explicit IntrusivePtr(T* ptr, bool add_ref = true) : ptr_(ptr)
+    {
+        if ((ptr_ != nullptr) && add_ref)
+        {
+            ptr_->AddRef();
+        }
+    }
+
+    IntrusivePtr(const IntrusivePtr& rhs) : IntrusivePtr(rhs.ptr_)
+    {
+    }
+
+    IntrusivePtr(IntrusivePtr&& rhs) noexcept : ptr_(std::exchange(rhs.ptr_, nullptr))
+    {
+    }
+
+    /**
+     * @brief Converting copy constructor (e.g. from derived signal to base)
+     */
+    template <typename U>
+        requires std::is_convertible_v<U*, T*>
+    IntrusivePtr(const IntrusivePtr<U>& rhs) : IntrusivePtr(rhs.get())
+    {
+    }
+
+    /**
+     * @brief Converting move constructor (e.g. from derived signal to base)
+     */
+    template <typename U>
+        requires std::is_convertible_v<U*, T*>
+    IntrusivePtr(IntrusivePtr<U>&& rhs) noexcept
+        : ptr_(std::exchange(rhs.ptr_, nullptr))
+    {
+    }
+
+    ~IntrusivePtr()
+    {
+        if (ptr_ != nullptr)
+        {
+            ptr_->Release();
+        }
+    }
+
+    IntrusivePtr& operator=(const IntrusivePtr& rhs)
+    {
+        IntrusivePtr(rhs).swap(*this);
+        return *this;
+    }
+
+    IntrusivePtr& operator=(IntrusivePtr&& rhs) noexcept
+    {
+        IntrusivePtr(std::move(rhs)).swap(*this);
+        return *this;
+    }
+
+    /**
+     * @brief Release reference, pointer becomes empty
+     */
+    void reset()
+    {
+        IntrusivePtr().swap(*this);
+    }
+
+    /**
+     * @brief Swap with other pointer
+     */
+    void swap(IntrusivePtr& rhs) noexcept
+    {
+        std::swap(ptr_, rhs.ptr_);
+    }
+
+    /**
+     * @brief Get raw pointer
+     */
+    [[nodiscard]] T* get() const
+    {
+        return ptr_;
+    }
+
+    /**
+     * @brief Release ownership without decrementing reference count
+     */
+    [[nodiscard]] T* Detach()
+    {
+        return std::exchange(ptr_, nullptr);
+    }
+
+    T* operator->() const
+    {
+        return ptr_;
+    }
+
+    T& operator*() const
+    {
+        return *ptr_;
+    }
+
+    explicit operator bool() const
+    {
+        return ptr_ != nullptr;
+    }
+
+    /**
+     * @brief Compare pointers
+     */
+    template <typename U>
+    bool operator==(const IntrusivePtr<U>& rhs) const
+    {
+        return ptr_ == rhs.get();
+    }
+
+    /**
+     * @brief Compare with nullptr
+     */
+    bool operator==(std::nullptr_t) const
+    {
+        return ptr_ == nullptr;
+    }
+
+private:
+    template <typename U>
+    friend class IntrusivePtr;
+
+    T* ptr_ = nullptr;
+};
+
+/**
+ * @brief Cast intrusive pointer, equivalent of std::static_pointer_cast
+ */
+template <typename T, typename U>
+IntrusivePtr<T> StaticPointerCast(const IntrusivePtr<U>& ptr)
+{
+    return IntrusivePtr<T>(static_cast<T*>(ptr.get()));
+}
+
+/**
+ * @brief Cast intrusive pointer, equivalent of std::static_pointer_cast (no reference count traffic)
+ */
+template <typename T, typename U>
+IntrusivePtr<T> StaticPointerCast(IntrusivePtr<U>&& ptr)
+{
+    return IntrusivePtr<T>(static_cast<T*>(ptr.Detach()), false);
+}
+} // namespace cpp_event_framework
@@ -0,0 +1,209 @@
+/**
+ * @file OrthogonalRegions.hxx
+ * @author Dirk Ziegelmeier (dirk@ziegelmeier.net)
+ * @brief
+ * @date 16-10-2026
+ *
+ * @copyright SPDX-License-Identifier: Apache-2.0
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <cpp_event_framework/Statemachine.hxx>
+
+namespace cpp_event_framework
+{
+/**
+ * @brief Orthogonal (AND-) regions: several statemachines that are active at the same time and react to the
+ * same events. React() passes the event reference to all regions in one pass, in region order (first template
+ * argument first). Each region runs to completion before the next one sees the event.
+ *
+ * Deferral/recall is handled here, regions must not use their own on_defer_event_/on_recall_deferred_events_:
+ * - An event deferred by one or more regions is stored once, together with the set of deferring regions.
+ *   Regions that did not defer it have already processed it normally.
+ * - When a region calls RecallEvents(), its deferred events are dispatched again to that region only, after the
+ *   current pass has completed, in the order they were deferred.
+ *
+ * @tparam Regions Statemachine types (RuntimeStatemachineHooks policy), all with the same Event type
+ */
+template <typename... Regions>
+class OrthogonalRegions
+{
+public:
+    /**
+     * @brief Number of regions
+     */
+    static constexpr size_t kNumRegions = sizeof...(Regions);
+
+    static_assert(kNumRegions > 0);
+    static_assert(kNumRegions <= 32, "Region set is stored as 32 bit mask");
+    static_assert((Regions::kRuntimeHooks && ...), "Regions need runtime deferral hooks");
+
+    /**
+     * @brief Event type, shared by all regions
+     */
+    using Event = typename std::tuple_element_t<0, std::tuple<Regions...>>::Event;
+
+    static_assert((std::is_same_v<Event, typename Regions::Event> && ...), "All regions need the same event type");
+
+    /**
+     * @brief Set of regions, bit N: region N
+     */
+    using RegionMask = uint32_t;
+
+    /**
+     * @brief Construct regions
+     */
+    OrthogonalRegions()
+    {
+        InstallHooks(std::make_index_sequence<kNumRegions>());
+    }
+
+    ~OrthogonalRegions() = default;
+
+    // Non-copyable, non-movable (regions' hooks point to this object)
+    OrthogonalRegions(const OrthogonalRegions& rhs) = delete;
+    OrthogonalRegions(OrthogonalRegions&& rhs) = delete;
+    OrthogonalRegions& operator=(const OrthogonalRegions& rhs) = delete;
+    OrthogonalRegions& operator=(OrthogonalRegions&& rhs) = delete;
+
+    /**
+     * @brief Access a region, e.g. to call Init() or assign logging hooks
+     *
+     * @tparam Index Region index
+     */
+    template <size_t Index>
+    auto& Region()
+    {
+        return std::get<Index>(regions_);
+    }
+
+    /**
+     * @brief Access a region
+     *
+     * @tparam Index Region index
+     */
+    template <size_t Index>
+    const auto& Region() const
+    {
+        return std::get<Index>(regions_);
+    }
+
+    /**
+     * @brief Start all regions, in region order
+     *
+     * @param initial Initial state per region
+     */
+    void Start(typename Regions::StatePtr... initial)
+    {
+        deferred_.clear();
+        std::apply([&initial...](auto&... region) { (region.Start(initial), ...); }, regions_);
+    }
+
+    /**
+     * @brief Synchronously react to an event in all regions
+     *
+     * @param event Event
+     */
+    void React(Event event)
+    {
+        Dispatch(event, kAllRegions);
+        DispatchRecalledEvents();
+    }
+
+    /**
+     * @brief Number of events deferred by at least one region
+     *
+     * @return size_t
+     */
+    [[nodiscard]] size_t NumDeferredEvents() const
+    {
+        return deferred_.size();
+    }
+
+private:
+    static constexpr RegionMask kAllRegions = static_cast<RegionMask>((uint64_t(1) << kNumRegions) - 1);
+
+    struct DeferredEvent
+    {
+        std::remove_cvref_t<Event> event;
+        RegionMask regions;
+    };
+
+    std::tuple<Regions...> regions_;
+    std::vector<DeferredEvent> deferred_;
+    // Regions that deferred the event of the current pass
+    RegionMask deferring_ = 0;
+    // Regions that recalled their deferred events, not yet dispatched
+    RegionMask recalling_ = 0;
+
+    template <size_t... Indices>
+    void InstallHooks(std::index_sequence<Indices...> /*indices*/)
+    {
+        (InstallHooks<Indices>(), ...);
+    }
+
+    template <size_t Index>
+    void InstallHooks()
+    {
+        auto& region = std::get<Index>(regions_);
+        using Region = std::remove_cvref_t<decltype(region)>;
+        region.on_defer_event_ = [this](typename Region::StateRef /*state*/, Event /*event*/)
+        { deferring_ |= RegionMask(1) << Index; };
+        region.on_recall_deferred_events_ = [this](typename Region::StateRef /*state*/)
+        { recalling_ |= RegionMask(1) << Index; };
+    }
+
+    void Dispatch(Event event, RegionMask regions)
+    {
+        deferring_ = 0;
+        DispatchRegions(event, regions, std::make_index_sequence<kNumRegions>());
+
+        if (deferring_ != 0)
+        {
+            deferred_.emplace_back(event, deferring_);
+        }
+    }
+
+    template <size_t... Indices>
+    void DispatchRegions(Event event, RegionMask regions, std::index_sequence<Indices...> /*indices*/)
+    {
+        ((((regions >> Indices) & 1U) != 0 ? std::get<Indices>(regions_).React(event) : void()), ...);
+    }
+
+    void DispatchRecalledEvents()
+    {
+        while (recalling_ != 0)
+        {
+            const RegionMask recalled = recalling_;
+            recalling_ = 0;
+
+            // Take out first - dispatching may defer events again
+            std::vector<DeferredEvent> events;
+            for (auto& deferred : deferred_)
+            {
+                const RegionMask regions = deferred.regions & recalled;
+                if (regions != 0)
+                {
+                    events.emplace_back(deferred.event, regions);
+                    deferred.regions &= ~regions;
+                }
+            }
+            std::erase_if(deferred_, [](const auto& deferred) { return deferred.regions == 0; });
+
+            for (const auto& deferred : events)
+            {
+                Dispatch(deferred.event, deferred.regions);
+            }
+        }
+    }
+};
+} // namespace cpp_event_framework
@@ -10,13 +10,13 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <memory_resource>
 #include <mutex>
 #include <ostream>
-#include <queue>
 #include <string>
 #include <vector>
 
@@ -24,8 +24,28 @@
 
 namespace cpp_event_framework
 {
+/**
+ * @brief Growth behaviour of a Pool when it runs empty
+ */
+struct PoolGrowthPolicy
+{
+    /**
+     * @brief Number of elements added per growth step (one contiguous slab). 0: pool does not grow.
+     */
+    size_t slab_size = 0;
+    /**
+     * @brief Max. total number of elements including initial elements. 0: unlimited.
+     */
+    size_t max_size = 0;
+};
+
 /**
  * @brief Pool of elements, especially useful for signals
+ * Free elements are kept in an intrusive LIFO list stored inside the elements themselves, so the most recently
+ * freed (cache-hot) element is handed out first and there is no per-element bookkeeping memory.
+ * By default the pool has a fixed number of elements and asserts when it runs empty. Optionally, it can grow
+ * by slabs of elements (see PoolGrowthPolicy). Grown slabs are only released by an explicit call to Trim(), so
+ * allocation and deallocation stay O(1).
  *
  * @tparam MutexType Mutex type to use - e.g. to be able to supply own RT-capable implementation.
  *         NamedRequirements: DefaultConstructible, Destructible, BasicLockable
@@ -53,17 +73,16 @@ public:
      * @brief Construct a new Pool object
      *
      * @param element_size Size of each pool element
-     * @param count Number of pool elements
+     * @param count Number of initial pool elements
      * @param name Pool name (logging)
+     * @param growth Growth policy, default: fixed size
      */
-    Pool(size_t element_size, size_t count, std::string name)
-        : size_(count), element_size_(((element_size + Alignment) / Alignment) * Alignment), name_(std::move(name))
+    Pool(size_t element_size, size_t count, std::string name, PoolGrowthPolicy growth = {})
+        : element_size_(std::max(sizeof(void*), ((element_size + Alignment) / Alignment) * Alignment))
+        , name_(std::move(name))
+        , growth_(growth)
     {
-        pool_mem_.resize(element_size_ * size_);
-        for (size_t i = 0; i < count; i++)
-        {
-            pool_.push(&pool_mem_.at(i * element_size_));
-        }
+        AddSlab(count);
     }
 
     ~Pool() = default;
@@ -81,9 +100,16 @@ public:
         AssertionProviderType::Assert(bytes <= element_size_);
 
         std::scoped_lock lock(mutex_);
-        AssertionProviderType::Assert(!pool_.empty());
-        auto* result = pool_.front();
-        pool_.pop();
+        if (free_list_ == nullptr)
+        {
+            Grow();
+        }
+        AssertionProviderType::Assert(free_list_ != nullptr);
+        auto* result = free_list_;
+        free_list_ = Next(result);
+        free_count_--;
+
+        high_watermark_ = std::max(high_watermark_, size_ - free_count_);
         return result;
     }
 
@@ -93,7 +119,7 @@ public:
     void do_deallocate(void* p, size_t /*bytes*/, size_t /*alignment*/) override
     {
         std::scoped_lock lock(mutex_);
-        pool_.push(p);
+        Push(p);
     }
 
     /**
@@ -104,6 +130,59 @@ public:
         return *this == other;
     }
 
+    /**
+     * @brief Release grown slabs whose elements are all free. The initial elements are never released.
+     * Walks the free list, call it from a non time-critical context (e.g. idle or after load peaks).
+     *
+     * @return size_t Number of released elements
+     */
+    size_t Trim()
+    {
+        std::scoped_lock lock(mutex_);
+        if (slabs_.size() == 1)
+        {
+            return 0;
+        }
+
+        // Count free elements per grown slab
+        std::vector<size_t> free_count(slabs_.size(), 0);
+        for (auto* element = free_list_; element != nullptr; element = Next(element))
+        {
+            free_count.at(SlabIndex(element))++;
+        }
+
+        // Drop elements of completely free slabs from free list, then release the slabs
+        std::vector<bool> release(slabs_.size(), false);
+        for (size_t i = 1; i < slabs_.size(); i++)
+        {
+            release.at(i) = (free_count.at(i) * element_size_ == slabs_.at(i).size());
+        }
+        void** link = &free_list_;
+        while (*link != nullptr)
+        {
+            if (release.at(SlabIndex(*link)))
+            {
+                *link = Next(*link);
+                free_count_--;
+            }
+            else
+            {
+                link = static_cast<void**>(*link);
+            }
+        }
+        size_t released = 0;
+        for (size_t i = slabs_.size() - 1; i > 0; i--)
+        {
+            if (release.at(i))
+            {
+                released += slabs_.at(i).size() / element_size_;
+                slabs_.erase(slabs_.begin() + static_cast<std::ptrdiff_t>(i));
+            }
+        }
+        size_ -= released;
+        return released;
+    }
+
     /**
      * @brief Pool fill level (number of elements currently in pool)
      *
@@ -111,11 +190,11 @@ public:
      */
     [[nodiscard]] size_t FillLevel() const
     {
-        return pool_.size();
+        return free_count_;
     }
 
     /**
-     * @brief Get pool size (max. number of elements)
+     * @brief Get pool size (current number of elements, including grown slabs)
      *
      * @return size_t
      */
@@ -124,6 +203,26 @@ public:
         return size_;
     }
 
+    /**
+     * @brief Max. number of elements that were in use at the same time
+     *
+     * @return size_t
+     */
+    [[nodiscard]] size_t HighWatermark() const
+    {
+        return high_watermark_;
+    }
+
+    /**
+     * @brief Number of slabs (initial elements count as one slab)
+     *
+     * @return size_t
+     */
+    [[nodiscard]] size_t NumSlabs() const
+    {
+        return slabs_.size();
+    }
+
     /**
      * @brief Get size of pool elements
      *
@@ -149,9 +248,9 @@ public:
      *
      * @return SPtr
      */
-    static SPtr MakeShared(size_t element_size, size_t count, std::string name)
+    static SPtr MakeShared(size_t element_size, size_t count, std::string name, PoolGrowthPolicy growth = {})
     {
-        return std::make_shared<Pool>(element_size, count, std::move(name));
+        return std::make_shared<Pool>(element_size, count, std::move(name), growth);
     }
 
     /**
@@ -159,7 +258,8 @@ public:
      */
     friend std::ostream& operator<<(std::ostream& ostream, const Pool<MutexType, Alignment>& pool)
     {
-        return ostream << pool.Name() << " [" << pool.FillLevel() << "/" << pool.Size() << "]";
+        return ostream << pool.Name() << " [" << pool.FillLevel() << "/" << pool.Size() << ", max. used "
+                       << pool.HighWatermark() << "]";
     }
 
     /**
@@ -171,11 +271,66 @@ public:
     }
 
 private:
-    std::vector<uint8_t> pool_mem_;
-    std::queue<void*> pool_;
+    // First slab holds the initial elements and is never released
+    std::vector<std::vector<uint8_t>> slabs_;
+    void* free_list_ = nullptr;
+    size_t free_count_ = 0;
     MutexType mutex_;
     size_t size_ = 0;
     size_t element_size_ = 0;
     std::string name_;
+    PoolGrowthPolicy growth_;
+    size_t high_watermark_ = 0;
+
+    void AddSlab(size_t count)
+    {
+        auto& slab = slabs_.emplace_back(element_size_ * count);
+        // Push in reverse order so elements are handed out in ascending address order
+        for (size_t i = count; i > 0; i--)
+        {
+            Push(&slab.at((i - 1) * element_size_));
+        }
+        size_ += count;
+    }
+
+    static void* Next(void* element)
+    {
+        return *static_cast<void**>(element);
+    }
+
+    void Push(void* element)
+    {
+        *static_cast<void**>(element) = free_list_;
+        free_list_ = element;
+        free_count_++;
+    }
+
+    void Grow()
+    {
+        auto count = growth_.slab_size;
+        if (growth_.max_size != 0)
+        {
+            count = std::min(count, growth_.max_size - std::min(growth_.max_size, size_));
+        }
+        if (count != 0)
+        {
+            AddSlab(count);
+        }
+    }
+
+    size_t SlabIndex(void* element) const
+    {
+        auto* address = static_cast<uint8_t*>(element);
+        for (size_t i = 0; i < slabs_.size(); i++)
+        {
+            const auto& slab = slabs_.at(i);
+            if ((address >= slab.data()) && (address < slab.data() + slab.size()))
+            {
+                return i;
+            }
+        }
+        AssertionProviderType::Assert(false);
+        return 0;
+    }
 };
 } // namespace cpp_event_framework
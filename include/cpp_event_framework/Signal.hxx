@@ -10,14 +10,20 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <memory_resource>
 #include <ostream>
+#include <type_traits>
 
 #include <cpp_event_framework/Concepts.hxx>
 #include <cpp_event_framework/DemangledTypeName.hxx>
 #include <cpp_event_framework/HeapAllocator.hxx>
+#include <cpp_event_framework/IntrusivePtr.hxx>
 
 namespace cpp_event_framework
 {
@@ -41,6 +47,11 @@ public:
      */
     using IdType = uint32_t;
 
+    /**
+     * @brief Priority type alias
+     */
+    using PriorityType = uint8_t;
+
     // Not copyable, not movable - always use shared pointers!
     Signal(const Signal& rhs) = delete;
     Signal(Signal&& rhs) = delete;
@@ -58,11 +69,28 @@ public:
         return id_;
     }
 
+    /**
+     * @brief Check whether signal carries an intrusive queue hook (see cpp_active_objects::LinkableSignal)
+     */
+    [[nodiscard]] bool IsLinkable() const
+    {
+        return linkable_;
+    }
+
     /**
      * @brief Get event name
      */
     [[nodiscard]] virtual const char* Name() const = 0;
 
+    /**
+     * @brief Get event priority, used by priority queues (see cpp_active_objects::PriorityEventQueue).
+     * Higher value: more urgent. Default: 0 (lowest), override in signal classes that carry control traffic.
+     */
+    [[nodiscard]] virtual PriorityType Priority() const
+    {
+        return 0;
+    }
+
     /**
      * @brief Cast from generic signal
      */
@@ -86,6 +114,15 @@ protected:
     explicit Signal(IdType signal_id) : id_(signal_id)
     {
     }
+    /**
+     * @brief Construct a new Signal object
+     *
+     * @param signal_id Signal ID
+     * @param linkable Signal is derived from an intrusive queue hook class
+     */
+    Signal(IdType signal_id, bool linkable) : id_(signal_id), linkable_(linkable)
+    {
+    }
     /**
      * @brief Destroy the Signal object
      */
@@ -93,6 +130,7 @@ protected:
 
 private:
     const IdType id_;
+    const bool linkable_ = false;
 };
 
 /**
@@ -101,6 +139,109 @@ private:
 template <typename T>
 concept SignalSubclass = std::is_base_of_v<Signal, T>;
 
+/**
+ * @brief Signal with embedded reference count, to be used via IntrusivePtr instead of std::shared_ptr.
+ * Use as BaseType of SignalBase and create instances with SignalBase::MakeIntrusive(). No control block is
+ * allocated, so pool elements are sizeof(T) (see SignalPoolElementSizeCalculator::kHeapSize).
+ *
+ * @tparam ThreadSafe true: atomic reference count. false: plain counter, only for signals that never leave
+ *         one thread (e.g. events inside one active object domain).
+ */
+template <bool ThreadSafe = true>
+class RefCountedSignal : public Signal
+{
+public:
+    /**
+     * @brief Intrusive pointer alias
+     */
+    using IPtr = IntrusivePtr<RefCountedSignal>;
+
+    /**
+     * @brief Increment reference count
+     */
+    void AddRef() const
+    {
+        if constexpr (ThreadSafe)
+        {
+            ref_count_.fetch_add(1, std::memory_order_relaxed);
+        }
+        else
+        {
+            ref_count_++;
+        }
+    }
+
+    /**
+     * @brief Decrement reference count, destroys signal when last reference is released
+     */
+    void Release() const
+    {
+        if constexpr (ThreadSafe)
+        {
+            if (ref_count_.fetch_sub(1, std::memory_order_acq_rel) != 1)
+            {
+                return;
+            }
+        }
+        else
+        {
+            if (--ref_count_ != 0)
+            {
+                return;
+            }
+        }
+        destroy_(const_cast<RefCountedSignal*>(this));
+    }
+
+    /**
+     * @brief Cast from generic signal
+     */
+    static IPtr FromSignal(const IPtr& event)
+    {
+        return event;
+    }
+
+    /**
+     * @brief std::shared_ptr sharing ownership of an intrusive event, for interfaces that only take Signal::SPtr.
+     * Holds an intrusive reference until the last std::shared_ptr is gone, allocates a control block.
+     */
+    static Signal::SPtr SharedFromIntrusive(const IPtr& event)
+    {
+        return Signal::SPtr(event.get(), [reference = event](const Signal* /*signal*/) {});
+    }
+
+    /**
+     * @brief Stream operator for logging
+     */
+    friend std::ostream& operator<<(std::ostream& ostream, const IPtr& event)
+    {
+        return ostream << event->Name();
+    }
+
+protected:
+    /**
+     * @brief Construct a new RefCountedSignal object
+     */
+    explicit RefCountedSignal(IdType signal_id) : Signal(signal_id)
+    {
+    }
+
+    /**
+     * @brief Function that destroys and deallocates the signal, set by SignalBase::MakeIntrusive()
+     */
+    void (*destroy_)(RefCountedSignal* signal) = nullptr;
+
+private:
+    mutable std::conditional_t<ThreadSafe, std::atomic<uint32_t>, uint32_t> ref_count_ = 0;
+};
+
+/**
+ * @brief Concept for a class derived from RefCountedSignal
+ */
+template <typename T>
+concept RefCountedSignalSubclass =
+    std::is_base_of_v<RefCountedSignal<true>, T> || std::is_base_of_v<RefCountedSignal<false>, T>;
+
 /**
  * @brief Use this allocator to use a custom allocator (e.g. pool) as event source
  *
@@ -166,6 +307,11 @@ public:
      */
     using SPtr = std::shared_ptr<T>;
 
+    /**
+     * @brief Intrusive pointer alias (only for signals derived from RefCountedSignal)
+     */
+    using IPtr = IntrusivePtr<T>;
+
     /**
      * @brief Used allocator class
      */
@@ -177,15 +323,57 @@ public:
     static constexpr Signal::IdType kId = id;
 
     /**
-     * @brief Helper function to create shared-pointer managed instance
+     * @brief Helper function to create shared-pointer managed instance.
+     * Signals that opt in with "static constexpr bool kStateless = true;" (no payload, BaseType Signal or
+     * RefCountedSignal) are not allocated: a shared, never destroyed instance is returned via a non-owning pointer
+     * (no allocation, no reference counting). Note that weak pointers to such instances are always expired.
      *
      * @param args Constructor args
      */
     template <typename... Args>
     static SPtr MakeShared(Args&&... args)
     {
-        return std::allocate_shared<T, std::pmr::polymorphic_allocator<T>>(Allocator::GetAllocator(),
-                                                                           std::forward<Args>(args)...);
+        if constexpr (IsStateless())
+        {
+            // Sanity checks only, the signal class declares itself stateless
+            static_assert(sizeof...(Args) == 0, "Stateless signals take no constructor arguments");
+            static_assert(std::is_same_v<BaseType, Signal> || std::is_same_v<BaseType, RefCountedSignal<true>> ||
+                              std::is_same_v<BaseType, RefCountedSignal<false>>,
+                          "Stateless signals derive from Signal or RefCountedSignal directly");
+            static_assert(sizeof(T) == sizeof(BaseType), "Stateless signals must not have data members");
+            return SPtr(SPtr(), &Instance());
+        }
+        else
+        {
+            return std::allocate_shared<T, std::pmr::polymorphic_allocator<T>>(Allocator::GetAllocator(),
+                                                                               std::forward<Args>(args)...);
+        }
+    }
+
+    /**
+     * @brief Helper function to create intrusive reference counted instance (signal must be derived from
+     * RefCountedSignal). Allocated from the same allocator as MakeShared(), but without control block.
+     *
+     * @param args Constructor args
+     */
+    template <typename... Args>
+        requires RefCountedSignalSubclass<BaseType>
+    static IPtr MakeIntrusive(Args&&... args)
+    {
+        auto* allocator = Allocator::GetAllocator();
+        auto* mem = allocator->allocate(sizeof(T), alignof(T));
+        T* event = nullptr;
+        try
+        {
+            event = ::new (mem) T(std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            allocator->deallocate(mem, sizeof(T), alignof(T));
+            throw;
+        }
+        event->destroy_ = &DestroyIntrusive;
+        return IPtr(event);
     }
 
     /**
@@ -197,6 +385,16 @@ public:
         return std::static_pointer_cast<T>(event);
     }
 
+    /**
+     * @brief Convert from generic intrusive event to specific event class
+     */
+    template <typename U>
+    static IPtr FromSignal(const IntrusivePtr<U>& event)
+    {
+        AssertionProviderType::Assert(Check(event));
+        return StaticPointerCast<T>(event);
+    }
+
     /**
      * @brief Get event name
      */
@@ -213,6 +411,15 @@ public:
         return event->Id() == kId;
     }
 
+    /**
+     * @brief Check if intrusive event is of this kind
+     */
+    template <typename U>
+    static bool Check(const IntrusivePtr<U>& event)
+    {
+        return event->Id() == kId;
+    }
+
 protected:
     /**
      * @brief Helper to shorten possible constructor base class call
@@ -236,6 +443,36 @@ protected:
     explicit SignalBase(Args... args) : BaseType(kId, args...)
     {
     }
+
+private:
+    static constexpr bool IsStateless()
+    {
+        if constexpr (requires { T::kStateless; })
+        {
+            static_assert(std::is_same_v<decltype(T::kStateless), const bool>, "kStateless must be a bool constant");
+            return T::kStateless;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    static T& Instance()
+    {
+        // Constructed on first use and intentionally never destroyed, so it is valid during static destruction
+        alignas(T) static std::byte storage[sizeof(T)];
+        static T* instance = ::new (static_cast<void*>(storage)) T();
+        return *instance;
+    }
+
+    template <typename Base>
+    static void DestroyIntrusive(Base* signal)
+    {
+        auto* event = static_cast<T*>(signal);
+        event->~T();
+        Allocator::GetAllocator()->deallocate(event, sizeof(T), alignof(T));
+    }
 };
 
 /**
@@ -338,6 +575,42 @@ struct SptrPoolElementSize<Element, ElementList...>
                  SptrPoolElementSize<ElementList...>::kValue);
 };
 
+namespace detail
+{
+/**
+ * @brief Sort sizes and remove duplicates, unused trailing entries are 0
+ */
+template <size_t N>
+constexpr std::array<size_t, N> SortedUniqueSizes(std::array<size_t, N> sizes)
+{
+    std::sort(sizes.begin(), sizes.end());
+    auto end = std::unique(sizes.begin(), sizes.end());
+    std::fill(end, sizes.end(), 0);
+    return sizes;
+}
+
+/**
+ * @brief Number of distinct sizes
+ */
+template <size_t N>
+constexpr size_t NumUniqueSizes(const std::array<size_t, N>& sizes)
+{
+    return static_cast<size_t>(std::count_if(sizes.begin(), sizes.end(), [](size_t size) { return size != 0; }));
+}
+
+/**
+ * @brief Sorted list of distinct sizes
+ */
+template <size_t M, size_t N>
+constexpr std::array<size_t, M> SizeClasses(const std::array<size_t, N>& sizes)
+{
+    std::array<size_t, M> result = {};
+    auto unique = SortedUniqueSizes(sizes);
+    std::copy_n(unique.begin(), M, result.begin());
+    return result;
+}
+} // namespace detail
+
 /**
  * @brief Helper class to calculate pool sizes
  *
@@ -355,5 +628,19 @@ struct SignalPoolElementSizeCalculator
      * @brief Max element (heap size)
      */
     static constexpr uint32_t kSptrSize = SptrPoolElementSize<Args...>::kValue;
+
+    /**
+     * @brief Sorted distinct element sizes (heap size), for use with SizeClassPool
+     */
+    static constexpr auto kHeapSizeClasses = detail::SizeClasses<detail::NumUniqueSizes(
+        detail::SortedUniqueSizes(std::array<size_t, sizeof...(Args)>{PoolElementSize<Args>::kValue...}))>(
+        std::array<size_t, sizeof...(Args)>{PoolElementSize<Args>::kValue...});
+
+    /**
+     * @brief Sorted distinct element sizes (shared pointer size), for use with SizeClassPool
+     */
+    static constexpr auto kSptrSizeClasses = detail::SizeClasses<detail::NumUniqueSizes(
+        detail::SortedUniqueSizes(std::array<size_t, sizeof...(Args)>{SptrPoolElementSize<Args>::kValue...}))>(
+        std::array<size_t, sizeof...(Args)>{SptrPoolElementSize<Args>::kValue...});
 };
 } // namespace cpp_event_framework
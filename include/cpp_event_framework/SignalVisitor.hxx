@@ -0,0 +1,195 @@
+/**
+ * @file SignalVisitor.hxx
+ * @author Dirk Ziegelmeier (dirk@ziegelmeier.net)
+ * @brief
+ * @date 16-10-2026
+ *
+ * @copyright SPDX-License-Identifier: Apache-2.0
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <utility>
+
+#include <cpp_event_framework/Signal.hxx>
+
+namespace cpp_event_framework
+{
+/**
+ * @brief Handler for one signal type, see On()
+ *
+ * @tparam SignalType Signal class (SignalBase/NextSignal derived)
+ * @tparam FunctionType Callable type
+ */
+template <SignalSubclass SignalType, typename FunctionType>
+struct SignalHandler
+{
+    /**
+     * @brief Handled signal class
+     */
+    using Signal = SignalType;
+
+    /**
+     * @brief Handler function, called with const SignalType& followed by the visitor's extra arguments
+     */
+    FunctionType function;
+};
+
+/**
+ * @brief Declare handler for a signal type
+ *
+ * @tparam SignalType Signal class
+ * @param function Callable, called with const SignalType& followed by the visitor's extra arguments
+ */
+template <SignalSubclass SignalType, typename FunctionType>
+constexpr SignalHandler<SignalType, FunctionType> On(FunctionType function)
+{
+    return {function};
+}
+
+/**
+ * @brief Dispatches a signal to the handler registered for its type via a dense jump table indexed by
+ * Signal::Id(), built at compile time from the kId values of the handled signals. Replaces chains of
+ * Check()/FromSignal() comparisons. The signal is passed to the handler as reference to its actual type,
+ * no shared pointer is copied. Signals without handler (or with an ID outside the table) go to the default handler.
+ * Use MakeSignalVisitor() to create instances.
+ *
+ * @tparam ResultType Return type of all handlers
+ * @tparam ExtraArgs Additional arguments passed to all handlers (e.g. implementation pointer)
+ * @tparam DefaultType Default handler type, called with const Signal&
+ * @tparam Handlers SignalHandler types
+ */
+template <typename ResultType, typename ExtraArgs, typename DefaultType, typename... Handlers>
+class SignalVisitor;
+
+/**
+ * @brief Specialization to unpack extra arguments
+ */
+template <typename ResultType, typename... ExtraArgs, typename DefaultType, typename... Handlers>
+class SignalVisitor<ResultType, std::tuple<ExtraArgs...>, DefaultType, Handlers...>
+{
+public:
+    static_assert(sizeof...(Handlers) > 0);
+
+    /**
+     * @brief Lowest handled signal ID
+     */
+    static constexpr Signal::IdType kMinId = std::min({Handlers::Signal::kId...});
+
+    /**
+     * @brief Highest handled signal ID
+     */
+    static constexpr Signal::IdType kMaxId = std::max({Handlers::Signal::kId...});
+
+    /**
+     * @brief Number of jump table entries
+     */
+    static constexpr size_t kTableSize = kMaxId - kMinId + 1;
+
+    static_assert(kTableSize <= 1024, "Signal IDs too sparse for a dense jump table");
+
+    /**
+     * @brief Construct visitor
+     *
+     * @param default_handler Called for signals without handler
+     * @param handlers Signal handlers
+     */
+    constexpr explicit SignalVisitor(DefaultType default_handler, Handlers... handlers)
+        : default_(default_handler), handlers_(handlers...)
+    {
+    }
+
+    /**
+     * @brief Dispatch signal to its handler
+     *
+     * @param event Signal
+     * @param args Extra arguments
+     * @return ResultType
+     */
+    ResultType operator()(const Signal& event, ExtraArgs... args) const
+    {
+        const auto index = static_cast<size_t>(event.Id() - kMinId);
+        // IDs below kMinId wrap around and fail this check as well
+        if (index >= kTableSize)
+        {
+            return default_(event, args...);
+        }
+        return kTable.at(index)(*this, event, args...);
+    }
+
+    /**
+     * @brief Dispatch signal to its handler
+     *
+     * @param event Signal
+     * @param args Extra arguments
+     * @return ResultType
+     */
+    template <typename PointerType>
+        requires requires(const PointerType& ptr) { static_cast<const Signal&>(*ptr); }
+    ResultType operator()(const PointerType& event, ExtraArgs... args) const
+    {
+        return (*this)(static_cast<const Signal&>(*event), args...);
+    }
+
+private:
+    using EntryType = ResultType (*)(const SignalVisitor&, const Signal&, ExtraArgs...);
+
+    DefaultType default_;
+    std::tuple<Handlers...> handlers_;
+
+    template <size_t Index>
+    static ResultType CallHandler(const SignalVisitor& visitor, const Signal& event, ExtraArgs... args)
+    {
+        using SignalType = typename std::tuple_element_t<Index, std::tuple<Handlers...>>::Signal;
+        return std::get<Index>(visitor.handlers_).function(static_cast<const SignalType&>(event), args...);
+    }
+
+    static ResultType CallDefault(const SignalVisitor& visitor, const Signal& event, ExtraArgs... args)
+    {
+        return visitor.default_(event, args...);
+    }
+
+    template <size_t... Indices>
+    static constexpr std::array<EntryType, kTableSize> MakeTable(std::index_sequence<Indices...> /*indices*/)
+    {
+        std::array<EntryType, kTableSize> table = {};
+        table.fill(&CallDefault);
+        // First handler for an ID wins
+        ((table.at(Handlers::Signal::kId - kMinId) == &CallDefault
+              ? void(table.at(Handlers::Signal::kId - kMinId) = &CallHandler<Indices>)
+              : void()),
+         ...);
+        return table;
+    }
+
+    static constexpr std::array<EntryType, kTableSize> kTable =
+        MakeTable(std::make_index_sequence<sizeof...(Handlers)>());
+};
+
+/**
+ * @brief Create a SignalVisitor
+ *
+ * Example:
+ *     static const auto kVisitor = MakeSignalVisitor<Transition, ImplPtr>(
+ *         [](const Signal&, ImplPtr) { return UnhandledEvent(); },
+ *         On<Go1>([](const Go1&, ImplPtr impl) { return TransitionTo(kState2); }),
+ *         On<Go2>([](const Go2&, ImplPtr impl) { return NoTransition(); }));
+ *     return kVisitor(event, impl);
+ *
+ * @tparam ResultType Return type of all handlers
+ * @tparam ExtraArgs Additional arguments passed to all handlers
+ * @param default_handler Called with const Signal& for signals without handler
+ * @param handlers Handlers created with On<SignalType>()
+ */
+template <typename ResultType, typename... ExtraArgs, typename DefaultType, typename... Handlers>
+constexpr auto MakeSignalVisitor(DefaultType default_handler, Handlers... handlers)
+{
+    return SignalVisitor<ResultType, std::tuple<ExtraArgs...>, DefaultType, Handlers...>(default_handler,
+                                                                                         handlers...);
+}
+} // namespace cpp_event_framework
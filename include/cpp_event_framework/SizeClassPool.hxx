@@ -0,0 +1,219 @@
+/**
+ * @file SizeClassPool.hxx
+ * @author Dirk Ziegelmeier (dirk@ziegelmeier.net)
+ * @brief
+ * @date 16-10-2026
+ *
+ * @copyright SPDX-License-Identifier: Apache-2.0
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <utility>
+
+#include <cpp_event_framework/Concepts.hxx>
+#include <cpp_event_framework/Pool.hxx>
+
+namespace cpp_event_framework
+{
+/**
+ * @brief Pool consisting of several fixed element size sub-pools (size classes).
+ * Allocations are routed to the smallest size class that fits, so small signals do not occupy the space
+ * of the largest one. Size classes can be calculated from a signal list via
+ * SignalPoolElementSizeCalculator<...>::kSptrSizeClasses. Requests larger than the largest size class are
+ * forwarded to an upstream resource, by default std::pmr::null_memory_resource() (throws std::bad_alloc).
+ *
+ * @tparam ElementSizes std::array of element sizes, sorted ascending
+ * @tparam MutexType Mutex type to use - e.g. to be able to supply own RT-capable implementation.
+ *         NamedRequirements: DefaultConstructible, Destructible, BasicLockable
+ * @tparam Alignment Alignment requirement
+ */
+template <auto ElementSizes, Mutex MutexType = std::mutex, size_t Alignment = sizeof(uint64_t),
+          AssertionProvider AssertionProviderType = DefaultAssertionProvider>
+class SizeClassPool : public std::pmr::memory_resource
+{
+public:
+    /**
+     * @brief Number of size classes
+     */
+    static constexpr size_t kNumClasses = ElementSizes.size();
+
+    static_assert(kNumClasses > 0);
+    static_assert(std::is_sorted(ElementSizes.begin(), ElementSizes.end()));
+
+    /**
+     * @brief Shared pointer alias
+     */
+    using SPtr = std::shared_ptr<SizeClassPool>;
+
+    /**
+     * @brief Type of the sub-pools
+     */
+    using PoolType = Pool<MutexType, Alignment, AssertionProviderType>;
+
+    /**
+     * @brief Construct a new size class pool
+     *
+     * @param counts Number of elements per size class
+     * @param name Pool name (logging)
+     * @param upstream Resource for requests larger than the largest size class, must outlive this object
+     */
+    SizeClassPool(const std::array<size_t, kNumClasses>& counts, std::string name,
+                  std::pmr::memory_resource* upstream = std::pmr::null_memory_resource())
+        : pools_(MakePools(counts, name, std::make_index_sequence<kNumClasses>()))
+        , name_(std::move(name))
+        , upstream_(upstream)
+    {
+    }
+
+    ~SizeClassPool() = default;
+
+    SizeClassPool(const SizeClassPool& rhs) = delete;
+    SizeClassPool(SizeClassPool&& rhs) = delete;
+    SizeClassPool& operator=(const SizeClassPool& rhs) = delete;
+    SizeClassPool& operator=(SizeClassPool&& rhs) = delete;
+
+    /**
+     * @brief std::pmr::memory_resource::do_allocate
+     */
+    void* do_allocate(size_t bytes, size_t alignment) override
+    {
+        const auto index = ClassIndex(bytes);
+        if (index == kNumClasses)
+        {
+            return upstream_->allocate(bytes, alignment);
+        }
+        return pools_.at(index).allocate(bytes, alignment);
+    }
+
+    /**
+     * @brief std::pmr::memory_resource::do_deallocate
+     */
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override
+    {
+        const auto index = ClassIndex(bytes);
+        if (index == kNumClasses)
+        {
+            upstream_->deallocate(p, bytes, alignment);
+            return;
+        }
+        pools_.at(index).deallocate(p, bytes, alignment);
+    }
+
+    /**
+     * @brief std::pmr::memory_resource::do_is_equal
+     */
+    bool do_is_equal(const memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+
+    /**
+     * @brief Get index of the size class that serves allocations of a given size
+     *
+     * @param bytes Allocation size
+     * @return size_t kNumClasses if larger than all size classes (served by upstream resource)
+     */
+    [[nodiscard]] static constexpr size_t ClassIndex(size_t bytes)
+    {
+        for (size_t i = 0; i < kNumClasses; i++)
+        {
+            if (bytes <= ElementSizes.at(i))
+            {
+                return i;
+            }
+        }
+        return kNumClasses;
+    }
+
+    /**
+     * @brief Size class fill level (number of elements currently in sub-pool)
+     *
+     * @param index Size class index
+     * @return size_t
+     */
+    [[nodiscard]] size_t FillLevel(size_t index) const
+    {
+        return pools_.at(index).FillLevel();
+    }
+
+    /**
+     * @brief Get size class size (max. number of elements)
+     *
+     * @param index Size class index
+     * @return size_t
+     */
+    [[nodiscard]] size_t Size(size_t index) const
+    {
+        return pools_.at(index).Size();
+    }
+
+    /**
+     * @brief Get size of elements of a size class
+     *
+     * @param index Size class index
+     * @return size_t
+     */
+    [[nodiscard]] static constexpr size_t ElementSize(size_t index)
+    {
+        return ElementSizes.at(index);
+    }
+
+    /**
+     * @brief Get pool name
+     *
+     * @return const std::string&
+     */
+    [[nodiscard]] const std::string& Name() const
+    {
+        return name_;
+    }
+
+    /**
+     * @brief Helper function to create shared-pointer managed instance
+     *
+     * @return SPtr
+     */
+    static SPtr MakeShared(const std::array<size_t, kNumClasses>& counts, std::string name,
+                           std::pmr::memory_resource* upstream = std::pmr::null_memory_resource())
+    {
+        return std::make_shared<SizeClassPool>(counts, std::move(name), upstream);
+    }
+
+    /**
+     * @brief Stream operator for logging
+     */
+    friend std::ostream& operator<<(std::ostream& ostream, const SizeClassPool& pool)
+    {
+        ostream << pool.Name() << " [";
+        for (size_t i = 0; i < kNumClasses; i++)
+        {
+            ostream << (i == 0 ? "" : " ") << ElementSize(i) << ": " << pool.FillLevel(i) << "/" << pool.Size(i);
+        }
+        return ostream << "]";
+    }
+
+private:
+    std::array<PoolType, kNumClasses> pools_;
+    std::string name_;
+    std::pmr::memory_resource* upstream_ = nullptr;
+
+    template <size_t... Indices>
+    static std::array<PoolType, kNumClasses> MakePools(const std::array<size_t, kNumClasses>& counts,
+                                                       const std::string& name, std::index_sequence<Indices...>)
+    {
+        return {PoolType(ElementSizes.at(Indices), counts.at(Indices),
+                         name + "/" + std::to_string(ElementSizes.at(Indices)))...};
+    }
+};
+} // namespace cpp_event_framework
@@ -0,0 +1,123 @@
+/**
+ * @file SpscRing.hxx
+ * @author Dirk Ziegelmeier (dirk@ziegelmeier.net)
+ * @brief
+ * @date 16-10-2026
+ *
+ * @copyright SPDX-License-Identifier: Apache-2.0
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+namespace cpp_event_framework
+{
+/**
+ * @brief Assumed cache line size, used to pad indices that are written by different threads
+ */
+static constexpr size_t kCacheLineSize = 64;
+
+/**
+ * @brief Behaviour of a bounded queue when it is full
+ */
+enum class EQueueFullPolicy
+{
+    kAssert, ///< Fail assertion (queue must be dimensioned for worst case)
+    kSpin,   ///< Busy-wait (yield) until consumer made room. Not wait-free!
+    kDrop    ///< Discard the new entry
+};
+
+/**
+ * @brief Wait-free bounded single-producer/single-consumer ring buffer
+ * Exactly one thread may call TryPush(), exactly one (other) thread may call TryPop().
+ *
+ * @tparam T Element type, must be default constructible and move assignable
+ * @tparam Capacity Max. number of elements
+ */
+template <typename T, size_t Capacity>
+class SpscRing
+{
+public:
+    static_assert(Capacity > 0);
+
+    /**
+     * @brief Try to append an element (producer side)
+     *
+     * @param value Element, only moved from on success
+     * @return true Element was appended
+     * @return false Ring is full
+     */
+    bool TryPush(T& value)
+    {
+        const auto tail = tail_.load(std::memory_order_relaxed);
+        const auto next = Increment(tail);
+        if (next == cached_head_)
+        {
+            cached_head_ = head_.load(std::memory_order_acquire);
+            if (next == cached_head_)
+            {
+                return false;
+            }
+        }
+        slots_.at(tail) = std::move(value);
+        tail_.store(next, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Try to remove the oldest element (consumer side)
+     *
+     * @param value Receives element on success
+     * @return true Element was removed
+     * @return false Ring is empty
+     */
+    bool TryPop(T& value)
+    {
+        const auto head = head_.load(std::memory_order_relaxed);
+        if (head == cached_tail_)
+        {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            if (head == cached_tail_)
+            {
+                return false;
+            }
+        }
+        value = std::move(slots_.at(head));
+        slots_.at(head) = T();
+        head_.store(Increment(head), std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Get ring capacity (max. number of elements)
+     *
+     * @return size_t
+     */
+    [[nodiscard]] static constexpr size_t Size()
+    {
+        return Capacity;
+    }
+
+private:
+    // One slot is kept free to distinguish full from empty
+    static constexpr size_t kSlots = Capacity + 1;
+
+    static size_t Increment(size_t index)
+    {
+        return (index + 1 == kSlots) ? 0 : index + 1;
+    }
+
+    // Consumer cache line: consumer index and consumer's copy of producer index
+    alignas(kCacheLineSize) std::atomic<size_t> head_ = 0;
+    size_t cached_tail_ = 0;
+    // Producer cache line: producer index and producer's copy of consumer index
+    alignas(kCacheLineSize) std::atomic<size_t> tail_ = 0;
+    size_t cached_head_ = 0;
+    alignas(kCacheLineSize) std::array<T, kSlots> slots_ = {};
+};
+} // namespace cpp_event_framework
@@ -9,13 +9,20 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
-#include <map>
 #include <memory>
+#include <mutex>
+#include <ranges>
 #include <span>
+#include <type_traits>
 
 #include <cpp_event_framework/Concepts.hxx>
-#include <cpp_event_framework/HeapAllocator.hxx>
 
 namespace cpp_event_framework
 {
@@ -76,18 +83,129 @@ constexpr EStateFlags& operator&=(EStateFlags& lhs, EStateFlags rhs)
     return lhs;
 }
 
+/**
+ * @brief Statemachine hooks policy (default): hooks are members that can be assigned at runtime
+ * (on_state_entry_, on_defer_event_ etc.). Every step checks whether a hook is set.
+ */
+struct RuntimeStatemachineHooks
+{
+};
+
+/**
+ * @brief Statemachine hooks policy: no hooks, all tracing compiles away and the hook members do not exist.
+ * Events cannot be deferred, DeferEvent() and RecallEvents() do not compile.
+ *
+ * Also the base for compile-time tracers: derive from it and define any of the following static functions,
+ * they are called directly (and can be inlined) instead of via function pointers:
+ *     static void OnStateChange(Fsm::Ref fsm, Fsm::Event event, Fsm::StateRef from, Fsm::StateRef to);
+ *     static void OnStateEntry(Fsm::Ref fsm, Fsm::StateRef state);
+ *     static void OnStateExit(Fsm::Ref fsm, Fsm::StateRef state);
+ *     static void OnHandleEvent(Fsm::Ref fsm, Fsm::StateRef state, Fsm::Event event);
+ *     static void OnUnhandledEvent(Fsm::Ref fsm, Fsm::StateRef state, Fsm::Event event);
+ *     static void OnDeferEvent(Fsm::Ref fsm, Fsm::StateRef state, Fsm::Event event);
+ *     static void OnRecallDeferredEvents(Fsm::Ref fsm, Fsm::StateRef state);
+ * The functions may also be templates deducing the statemachine type from the first parameter:
+ *     template <typename Fsm> static void OnStateEntry(const Fsm& fsm, typename Fsm::StateRef state);
+ * A declared hook that does not match its signature (or is private) is rejected at compile time. Defining
+ * OnDeferEvent() and OnRecallDeferredEvents() enables DeferEvent() and RecallEvents().
+ */
+struct NoStatemachineHooks
+{
+};
+
+namespace detail
+{
+/**
+ * @brief Placeholder for a hook member that does not exist with the selected hooks policy
+ */
+template <size_t Index>
+struct AbsentStatemachineHook
+{
+};
+
+/**
+ * @brief One member per hook name. Name lookup in StatemachineHookProbe<Hooks> is ambiguous if and only if Hooks
+ * declares a member with that name itself - whatever its signature and access.
+ */
+struct StatemachineHookNames
+{
+    static void OnStateChange();
+    static void OnStateEntry();
+    static void OnStateExit();
+    static void OnHandleEvent();
+    static void OnUnhandledEvent();
+    static void OnDeferEvent();
+    static void OnRecallDeferredEvents();
+};
+
+template <typename Hooks>
+struct StatemachineHookProbe : Hooks, StatemachineHookNames
+{
+};
+
+template <typename Hooks>
+concept DeclaresOnStateChange = !requires { &StatemachineHookProbe<Hooks>::OnStateChange; };
+template <typename Hooks>
+concept DeclaresOnStateEntry = !requires { &StatemachineHookProbe<Hooks>::OnStateEntry; };
+template <typename Hooks>
+concept DeclaresOnStateExit = !requires { &StatemachineHookProbe<Hooks>::OnStateExit; };
+template <typename Hooks>
+concept DeclaresOnHandleEvent = !requires { &StatemachineHookProbe<Hooks>::OnHandleEvent; };
+template <typename Hooks>
+concept DeclaresOnUnhandledEvent = !requires { &StatemachineHookProbe<Hooks>::OnUnhandledEvent; };
+template <typename Hooks>
+concept DeclaresOnDeferEvent = !requires { &StatemachineHookProbe<Hooks>::OnDeferEvent; };
+template <typename Hooks>
+concept DeclaresOnRecallDeferredEvents = !requires { &StatemachineHookProbe<Hooks>::OnRecallDeferredEvents; };
+
+/**
+ * @brief Every hook Hooks declares is callable by statemachine Fsm with one of the signatures documented at
+ * NoStatemachineHooks. Hooks that are not declared at all are fine.
+ */
+template <typename Hooks, typename Fsm>
+concept ValidStatemachineHooks =
+    requires(typename Fsm::Ref fsm, typename Fsm::StateRef state, typename Fsm::Event event) {
+        requires !DeclaresOnStateChange<Hooks> || requires { Hooks::OnStateChange(fsm, event, state, state); };
+        requires !DeclaresOnStateEntry<Hooks> || requires { Hooks::OnStateEntry(fsm, state); };
+        requires !DeclaresOnStateExit<Hooks> || requires { Hooks::OnStateExit(fsm, state); };
+        requires !DeclaresOnHandleEvent<Hooks> || requires { Hooks::OnHandleEvent(fsm, state, event); };
+        requires !DeclaresOnUnhandledEvent<Hooks> || requires { Hooks::OnUnhandledEvent(fsm, state, event); };
+        requires !DeclaresOnDeferEvent<Hooks> || requires { Hooks::OnDeferEvent(fsm, state, event); };
+        requires !DeclaresOnRecallDeferredEvents<Hooks> || requires { Hooks::OnRecallDeferredEvents(fsm, state); };
+    };
+} // namespace detail
+
+template <typename FsmType>
+class StatemachineFleet;
+
 /**
  * @brief Statemachine implementation
  *
  * @tparam ImplType Statemachine implementation type
  * @tparam EventType Event type
- * @tparam HistoryMapAllocator Allocator for history map (only when history states are used)
+ * @tparam NumHistoryStates Max. number of history states of this statemachine type. History is stored in an
+ *         inline array per instance, no allocation.
+ * @tparam HooksType Tracing/deferral hooks policy: RuntimeStatemachineHooks, NoStatemachineHooks or a
+ *         compile-time tracer derived from NoStatemachineHooks
  */
-template <typename ImplType, typename EventType, PolymorphicAllocatorProvider HistoryMapAllocator = HeapAllocator,
-          AssertionProvider AssertionProviderType = DefaultAssertionProvider>
+template <typename ImplType, typename EventType, size_t NumHistoryStates = 8,
+          AssertionProvider AssertionProviderType = DefaultAssertionProvider,
+          typename HooksType = RuntimeStatemachineHooks>
 class Statemachine
 {
 public:
+    static_assert(NumHistoryStates < 255, "History slot is stored as uint8_t");
+
+    /**
+     * @brief true: hooks are runtime assignable members (RuntimeStatemachineHooks policy)
+     */
+    static constexpr bool kRuntimeHooks = std::is_same_v<HooksType, RuntimeStatemachineHooks>;
+
+    /**
+     * @brief Max. number of history states
+     */
+    static constexpr size_t kNumHistoryStates = NumHistoryStates;
+
     class State;
 
     /**
@@ -147,6 +265,12 @@ public:
      */
     using ActionType = void (ImplType::*)(Event);
 
+    /**
+     * @brief Number of nesting levels whose ancestors are cached per state (top-level states have depth 1).
+     * States may be nested deeper, ancestors below this level are found by walking up the parent pointers.
+     */
+    static constexpr size_t kCachedStateDepth = 8;
+
     /**
      * @brief State machine transition class, used internally
      */
@@ -372,6 +496,40 @@ public:
             return os << state.Name();
         }
 
+        /**
+         * @brief Nesting depth (top-level state: 1)
+         *
+         * @return size_t
+         */
+        [[nodiscard]] size_t Depth() const
+        {
+            const size_t depth = depth_.load(std::memory_order_acquire);
+            return (depth != 0) ? depth : CalculatePath();
+        }
+
+        /**
+         * @brief Ancestor on a given nesting level (0: top-level state, Depth() - 1: this state)
+         *
+         * @param level Nesting level, must be less than Depth()
+         * @return StatePtr
+         */
+        [[nodiscard]] StatePtr Ancestor(size_t level) const
+        {
+            const size_t depth = Depth();
+            AssertionProviderType::Assert(level < depth);
+            if (level < kCachedStateDepth)
+            {
+                return path_.at(level).load(std::memory_order_relaxed);
+            }
+
+            StatePtr state = this;
+            for (size_t i = depth - 1; i > level; i--)
+            {
+                state = state->parent_;
+            }
+            return state;
+        }
+
     private:
         constexpr State(const char* name, HandlerType handler, StatePtr parent, StatePtr initial,
                         EntryExitType on_single_entry, std::span<const EntryExitType> on_entry,
@@ -391,6 +549,38 @@ public:
         EntryExitType on_single_entry_ = nullptr;
         EntryExitType on_single_exit_ = nullptr;
         const char* name_ = nullptr;
+
+        // Upper kCachedStateDepth levels of the path from top-level state down to this state, calculated on first
+        // use so transitions do not need to chase parent pointers. Several statemachine instances (threads) may
+        // calculate it concurrently, they all store the same values.
+        mutable std::array<std::atomic<StatePtr>, kCachedStateDepth> path_ = {};
+        mutable std::atomic<uint32_t> depth_ = 0;
+        // History slot + 1 (0: not assigned yet), history states only
+        mutable std::atomic<uint8_t> history_slot_ = 0;
+
+        // Statemachine assigns history slots
+        friend class Statemachine;
+
+        size_t CalculatePath() const
+        {
+            size_t depth = 0;
+            for (StatePtr state = this; state != nullptr; state = state->parent_)
+            {
+                depth++;
+            }
+
+            size_t level = depth;
+            for (StatePtr state = this; state != nullptr; state = state->parent_)
+            {
+                level--;
+                if (level < kCachedStateDepth)
+                {
+                    path_.at(level).store(state, std::memory_order_relaxed);
+                }
+            }
+            depth_.store(static_cast<uint32_t>(depth), std::memory_order_release);
+            return depth;
+        }
     };
 
     /**
@@ -421,41 +611,46 @@ public:
     };
 
     /**
-     * @brief State is changed (useful for logging)
+     * @brief State is changed (useful for logging), RuntimeStatemachineHooks only
      */
-    void (*on_state_change_)(Ref, Event, StateRef, StateRef) = nullptr;
+    [[no_unique_address]] std::conditional_t<kRuntimeHooks, void (*)(Ref, Event, StateRef, StateRef),
+                                             detail::AbsentStatemachineHook<0>> on_state_change_ = {};
     /**
-     * @brief State is entered (useful for logging)
+     * @brief State is entered (useful for logging), RuntimeStatemachineHooks only
      */
-    void (*on_state_entry_)(Ref, StateRef) = nullptr;
+    [[no_unique_address]] std::conditional_t<kRuntimeHooks, void (*)(Ref, StateRef),
+                                             detail::AbsentStatemachineHook<1>> on_state_entry_ = {};
     /**
-     * @brief State is left (useful for logging)
+     * @brief State is left (useful for logging), RuntimeStatemachineHooks only
      */
-    void (*on_state_exit_)(Ref, StateRef) = nullptr;
+    [[no_unique_address]] std::conditional_t<kRuntimeHooks, void (*)(Ref, StateRef),
+                                             detail::AbsentStatemachineHook<2>> on_state_exit_ = {};
     /**
-     * @brief Event is passed to a state (useful for logging)
+     * @brief Event is passed to a state (useful for logging), RuntimeStatemachineHooks only
      */
-    void (*on_handle_event_)(Ref, StateRef, Event) = nullptr;
+    [[no_unique_address]] std::conditional_t<kRuntimeHooks, void (*)(Ref, StateRef, Event),
+                                             detail::AbsentStatemachineHook<3>> on_handle_event_ = {};
     /**
      * @brief Unhandled event callback, fired when top-level state does not handle
-     * event
+     * event, RuntimeStatemachineHooks only
      */
-    void (*on_unhandled_event_)(Ref, StateRef, Event) = nullptr;
+    [[no_unique_address]] std::conditional_t<kRuntimeHooks, void (*)(Ref, StateRef, Event),
+                                             detail::AbsentStatemachineHook<4>> on_unhandled_event_ = {};
     /**
-     * @brief Deferred event callback, fired event deferral is requested
+     * @brief Deferred event callback, fired event deferral is requested, RuntimeStatemachineHooks only
      */
-    std::function<void(StateRef, Event)> on_defer_event_;
+    [[no_unique_address]] std::conditional_t<kRuntimeHooks, std::function<void(StateRef, Event)>,
+                                             detail::AbsentStatemachineHook<5>> on_defer_event_ = {};
     /**
-     * @brief Deferred event callback, fired event recall is requested
+     * @brief Deferred event callback, fired event recall is requested, RuntimeStatemachineHooks only
      */
-    std::function<void(StateRef)> on_recall_deferred_events_;
+    [[no_unique_address]] std::conditional_t<kRuntimeHooks, std::function<void(StateRef)>,
+                                             detail::AbsentStatemachineHook<6>> on_recall_deferred_events_ = {};
 
     /**
      * @brief Construct a new Statemachine object
      */
-    Statemachine() : initial_(HistoryMapAllocator::GetAllocator())
-    {
-    }
+    Statemachine() = default;
     /**
      * @brief Copy constructor
      *
@@ -497,6 +692,9 @@ public:
      */
     void Init(ImplPtr impl, const char* name)
     {
+        // A hook with a typo in its signature, private or not static would be silently ignored otherwise
+        static_assert(kRuntimeHooks || detail::ValidStatemachineHooks<HooksType, Statemachine>,
+                      "HooksType declares an On... hook that does not match its signature, see NoStatemachineHooks");
         AssertionProviderType::Assert(impl != nullptr);
         name_ = name;
         impl_ = impl;
@@ -510,7 +708,7 @@ public:
     {
         AssertionProviderType::Assert(impl_ != nullptr); // Most probably you forgot to call Init()
         current_state_ = &kInTransition;
-        initial_.clear();
+        history_.fill(nullptr);
         EnterStatesFromDownTo(nullptr, initial, {});
     }
 
@@ -524,72 +722,69 @@ public:
         AssertionProviderType::Assert(current_state_ != nullptr); // Most probably you forgot to call Start()
         AssertionProviderType::Assert(!working_);                 // Most probably you are recursively calling React()
         working_ = true;
+        ReactUnchecked(event);
+        working_ = false;
+    }
 
-        Transition transition(kInTransition);
-        const auto* start = current_state_;
-        const auto* s = current_state_;
-
-        do
-        {
-            if (on_handle_event_ != nullptr)
-            {
-                on_handle_event_(*this, *s, event);
-            }
-            transition = s->handler_(impl_, event);
-
-            if (transition.target_ == &kDeferEvent)
-            {
-                AssertionProviderType::Assert(on_defer_event_ != nullptr);
-                on_defer_event_(*s, event);
-                working_ = false;
-                return;
-            }
-
-            s = s->parent_;
-        } while ((transition.target_ == nullptr) && (s != nullptr));
-
-        if ((transition.target_ != nullptr))
-        {
-            if (transition.target_ != &kNone)
-            {
-                const auto* common_parent = FindCommonParent(current_state_, transition.target_);
-
-                const auto* old_state = current_state_;
-                current_state_ = &kInTransition;
-
-                if ((on_state_change_ != nullptr) && (old_state != transition.target_))
-                {
-                    on_state_change_(*this, event, *old_state, *transition.target_);
-                }
+    /**
+     * @brief Synchronously react to a sequence of events (e.g. a burst taken from a queue), in order,
+     * run-to-completion per event. Checks are done once per call instead of once per event, hooks and entry/exit
+     * actions still run per event.
+     * Stops after an event that recalled deferred events (see RecallEvents()) or called StopReact(), so the
+     * caller can process the recalled events (or other events it queued in front) before the remaining ones.
+     *
+     * @param events Range of events
+     * @return size_t Number of processed events
+     */
+    template <std::ranges::input_range Range>
+        requires std::convertible_to<std::ranges::range_reference_t<Range>, Event>
+    size_t React(Range&& events)
+    {
+        AssertionProviderType::Assert(current_state_ != nullptr); // Most probably you forgot to call Start()
+        AssertionProviderType::Assert(!working_);                 // Most probably you are recursively calling React()
+        working_ = true;
+        stop_react_ = false;
 
-                ExitStatesFromUpTo(old_state, common_parent, event);
-                transition.ExecuteActions(impl_, event);
-                EnterStatesFromDownTo(common_parent, transition.target_, event);
-            }
-            else
-            {
-                // No transition
-                transition.ExecuteActions(impl_, event);
-            }
-        }
-        else
+        size_t processed = 0;
+        for (auto&& event : events)
         {
-            if (on_unhandled_event_ != nullptr)
+            ReactUnchecked(event);
+            processed++;
+            if (stop_react_)
             {
-                on_unhandled_event_(*this, *start, event);
+                break;
             }
         }
 
         working_ = false;
+        return processed;
+    }
+
+    /**
+     * @brief Make React() of a sequence of events return after the current event, e.g. because events were
+     * queued in front of the remaining ones. Call from the thread running React().
+     */
+    void StopReact()
+    {
+        stop_react_ = true;
     }
 
     /**
      * @brief Recall deferred events
      */
     void RecallEvents()
+        requires(kRuntimeHooks || detail::DeclaresOnRecallDeferredEvents<HooksType>)
     {
-        AssertionProviderType::Assert(on_recall_deferred_events_ != nullptr);
-        on_recall_deferred_events_(*current_state_);
+        stop_react_ = true;
+        if constexpr (kRuntimeHooks)
+        {
+            AssertionProviderType::Assert(on_recall_deferred_events_ != nullptr);
+            on_recall_deferred_events_(*current_state_);
+        }
+        else
+        {
+            HooksType::OnRecallDeferredEvents(*this, *current_state_);
+        }
     }
 
     /**
@@ -633,11 +828,13 @@ public:
     }
 
     /**
-     * @brief Defer event until state is exited
+     * @brief Defer event until state is exited. Not available if the hooks policy cannot defer events, i.e.
+     * NoStatemachineHooks without OnDeferEvent().
      *
      * @return Transition
      */
     static Transition DeferEvent()
+        requires(kRuntimeHooks || detail::DeclaresOnDeferEvent<HooksType>)
     {
         return Transition(kDeferEvent);
     }
@@ -714,46 +911,95 @@ public:
         return os << sm.Name();
     }
 
+    /**
+     * @brief Find innermost state that is ancestor (or self) of both states, O(depth)
+     *
+     * @param state1 State
+     * @param state2 State
+     * @return StatePtr Common parent, nullptr if there is none
+     */
     static StatePtr FindCommonParent(StatePtr state1, StatePtr state2)
     {
-        auto* state = state1;
-
-        while (state != nullptr)
+        if ((state1 == nullptr) || (state2 == nullptr))
         {
-            auto* parent = state2;
+            return nullptr;
+        }
 
-            while (parent != nullptr)
+        StatePtr common_parent = nullptr;
+        const auto depth = std::min(state1->Depth(), state2->Depth());
+        for (size_t level = 0; level < depth; level++)
+        {
+            if (state1->Ancestor(level) != state2->Ancestor(level))
             {
-                if (parent == state)
-                {
-                    return parent;
-                }
-
-                parent = parent->parent_;
+                break;
             }
-
-            state = state->parent_;
+            common_parent = state1->Ancestor(level);
         }
 
-        return nullptr;
+        return common_parent;
     }
 
 private:
     StatePtr current_state_ = nullptr;
     bool working_ = false;
+    bool stop_react_ = false;
     ImplPtr impl_ = nullptr;
     const char* name_ = nullptr;
-    std::pmr::map<StatePtr, StatePtr> initial_;
+    // Last active substate of each history state, indexed by history slot
+    std::array<StatePtr, NumHistoryStates> history_ = {};
+
+    // Protects assignment of history slots (only on first use of a history state)
+    static inline std::mutex registry_mutex_;
+    // Only modified with registry_mutex_ held, StatemachineFleet reads it without
+    static inline std::atomic<size_t> num_history_slots_ = 0;
+
+    // StatemachineFleet loads and stores current state and history per instance
+    template <typename FsmType>
+    friend class StatemachineFleet;
+    using FleetAssertionProvider = AssertionProviderType;
 
     static const State kInTransition;
     static const State kNone;
     static const State kDeferEvent;
 
+    // HistorySlot() result when all NumHistoryStates slots are taken: state behaves like a normal state
+    static constexpr size_t kNoHistorySlot = NumHistoryStates;
+
+    static size_t HistorySlot(StatePtr state)
+    {
+        const size_t slot = state->history_slot_.load(std::memory_order_acquire);
+        if (slot != 0)
+        {
+            return slot - 1;
+        }
+
+        // First use of this history state by any instance: assign next free slot
+        std::scoped_lock lock(registry_mutex_);
+        if (state->history_slot_.load(std::memory_order_relaxed) == 0)
+        {
+            const size_t num_slots = num_history_slots_.load(std::memory_order_relaxed);
+            // Most probably you need to increase NumHistoryStates
+            AssertionProviderType::Assert(num_slots < NumHistoryStates);
+            if (num_slots < NumHistoryStates)
+            {
+                state->history_slot_.store(static_cast<uint8_t>(num_slots + 1), std::memory_order_release);
+                num_history_slots_.store(num_slots + 1, std::memory_order_release);
+            }
+        }
+
+        const size_t assigned = state->history_slot_.load(std::memory_order_relaxed);
+        return (assigned != 0) ? (assigned - 1) : kNoHistorySlot;
+    }
+
     void SetInitialState(StatePtr state, StatePtr initial)
     {
         if ((state->flags_ & EFlags::kHistory) != EFlags::kNone)
         {
-            initial_[state] = initial;
+            const auto slot = HistorySlot(state);
+            if (slot != kNoHistorySlot)
+            {
+                history_.at(slot) = initial;
+            }
         }
         else
         {
@@ -765,86 +1011,203 @@ private:
     {
         if ((state->flags_ & EFlags::kHistory) != EFlags::kNone)
         {
-            auto search = initial_.find(state);
-            if (search != initial_.end())
+            const auto slot = HistorySlot(state);
+            if ((slot != kNoHistorySlot) && (history_.at(slot) != nullptr))
             {
-                return search->second;
+                return history_.at(slot);
             }
         }
 
         return state->initial_;
     }
 
-    void ExitState(StatePtr state, Event event)
+    void ReactUnchecked(Event event)
     {
-        if (on_state_exit_ != nullptr)
+        Transition transition(kInTransition);
+        const auto* start = current_state_;
+        const auto* s = current_state_;
+
+        do
         {
-            on_state_exit_(*this, *state);
-        }
+            NotifyHandleEvent(*s, event);
+            transition = s->handler_(impl_, event);
 
-        for (const auto& on_ex : state->on_exit_)
+            if (transition.target_ == &kDeferEvent)
+            {
+                NotifyDeferEvent(*s, event);
+                return;
+            }
+
+            s = s->parent_;
+        } while ((transition.target_ == nullptr) && (s != nullptr));
+
+        if ((transition.target_ != nullptr))
         {
-            (impl_->*on_ex)(event);
+            if (transition.target_ != &kNone)
+            {
+                const auto* common_parent = FindCommonParent(current_state_, transition.target_);
+
+                const auto* old_state = current_state_;
+                current_state_ = &kInTransition;
+
+                if (old_state != transition.target_)
+                {
+                    NotifyStateChange(event, *old_state, *transition.target_);
+                }
+
+                ExitStatesFromUpTo(old_state, common_parent, event);
+                transition.ExecuteActions(impl_, event);
+                EnterStatesFromDownTo(common_parent, transition.target_, event);
+            }
+            else
+            {
+                // No transition
+                transition.ExecuteActions(impl_, event);
+            }
+        }
+        else
+        {
+            NotifyUnhandledEvent(*start, event);
         }
     }
 
-    void ExitStatesFromUpTo(StatePtr from, StatePtr top, Event event)
+    void NotifyHandleEvent(StateRef state, Event event) const
     {
-        const auto* state = from;
+        if constexpr (kRuntimeHooks)
+        {
+            if (on_handle_event_ != nullptr)
+            {
+                on_handle_event_(*this, state, event);
+            }
+        }
+        else if constexpr (detail::DeclaresOnHandleEvent<HooksType>)
+        {
+            HooksType::OnHandleEvent(*this, state, event);
+        }
+    }
 
-        if (state == top)
+    void NotifyUnhandledEvent(StateRef state, Event event) const
+    {
+        if constexpr (kRuntimeHooks)
         {
-            ExitState(state, event);
+            if (on_unhandled_event_ != nullptr)
+            {
+                on_unhandled_event_(*this, state, event);
+            }
         }
-        else
+        else if constexpr (detail::DeclaresOnUnhandledEvent<HooksType>)
+        {
+            HooksType::OnUnhandledEvent(*this, state, event);
+        }
+    }
+
+    void NotifyStateChange(Event event, StateRef from, StateRef to) const
+    {
+        if constexpr (kRuntimeHooks)
         {
-            while (state != top)
+            if (on_state_change_ != nullptr)
             {
-                // Save history state
-                if (state->parent_ != nullptr)
-                {
-                    if ((state->parent_->flags_ & EFlags::kHistory) != EFlags::kNone)
-                    {
-                        SetInitialState(state->parent_, state);
-                    }
-                }
+                on_state_change_(*this, event, from, to);
+            }
+        }
+        else if constexpr (detail::DeclaresOnStateChange<HooksType>)
+        {
+            HooksType::OnStateChange(*this, event, from, to);
+        }
+    }
 
-                ExitState(state, event);
+    void NotifyDeferEvent(StateRef state, Event event)
+    {
+        if constexpr (kRuntimeHooks)
+        {
+            AssertionProviderType::Assert(on_defer_event_ != nullptr);
+            on_defer_event_(state, event);
+        }
+        else if constexpr (detail::DeclaresOnDeferEvent<HooksType>)
+        {
+            HooksType::OnDeferEvent(*this, state, event);
+        }
+        else
+        {
+            // Unreachable, DeferEvent() is not available with this hooks policy
+            AssertionProviderType::Assert(false);
+        }
+    }
 
-                state = state->parent_;
+    void ExitState(StatePtr state, Event event)
+    {
+        if constexpr (kRuntimeHooks)
+        {
+            if (on_state_exit_ != nullptr)
+            {
+                on_state_exit_(*this, *state);
             }
         }
+        else if constexpr (detail::DeclaresOnStateExit<HooksType>)
+        {
+            HooksType::OnStateExit(*this, *state);
+        }
+
+        for (const auto& on_ex : state->on_exit_)
+        {
+            (impl_->*on_ex)(event);
+        }
     }
 
-    void EnterState(StateRef state, Event event) const
+    void ExitStatesFromUpTo(StatePtr from, StatePtr top, Event event)
     {
-        if (on_state_entry_ != nullptr)
+        if (from == top)
         {
-            on_state_entry_(*this, state);
+            ExitState(from, event);
+            return;
         }
 
-        for (const auto& on_en : state.on_entry_)
+        // top is an ancestor of from (or nullptr): exit all states below top, innermost first
+        const size_t top_depth = (top != nullptr) ? top->Depth() : 0;
+        for (size_t level = from->Depth(); level > top_depth; level--)
         {
-            (impl_->*on_en)(event);
+            const auto* state = from->Ancestor(level - 1);
+
+            // Save history state
+            if ((state->parent_ != nullptr) && ((state->parent_->flags_ & EFlags::kHistory) != EFlags::kNone))
+            {
+                SetInitialState(state->parent_, state);
+            }
+
+            ExitState(state, event);
         }
     }
 
-    void EnterStatesFromDownToRecursive(StatePtr top, StatePtr target, Event event)
+    void EnterState(StateRef state, Event event) const
     {
-        // Don't enter topmost state
-        if ((target != nullptr) && (top != target))
+        if constexpr (kRuntimeHooks)
         {
-            EnterStatesFromDownToRecursive(top, target->parent_, event);
-            EnterState(*target, event);
+            if (on_state_entry_ != nullptr)
+            {
+                on_state_entry_(*this, state);
+            }
+        }
+        else if constexpr (detail::DeclaresOnStateEntry<HooksType>)
+        {
+            HooksType::OnStateEntry(*this, state);
+        }
+
+        for (const auto& on_en : state.on_entry_)
+        {
+            (impl_->*on_en)(event);
         }
     }
 
     void EnterStatesFromDownTo(StatePtr top, StatePtr target, Event event)
     {
-        // Enter all states up to parent
+        // Enter all states below top (top is an ancestor of target or nullptr) down to parent of target
         if (top != target)
         {
-            EnterStatesFromDownToRecursive(top, target->parent_, event);
+            const size_t target_depth = target->Depth();
+            for (size_t level = (top != nullptr) ? top->Depth() : 0; level + 1 < target_depth; level++)
+            {
+                EnterState(*target->Ancestor(level), event);
+            }
         }
 
         // Alywas enter target state (we may have exited it, possibly a self transition)
@@ -864,19 +1227,20 @@ private:
     }
 };
 
-template <typename Impl, typename Event, PolymorphicAllocatorProvider Allocator,
-          AssertionProvider AssertionProviderType>
-const typename Statemachine<Impl, Event, Allocator, AssertionProviderType>::State
-    Statemachine<Impl, Event, Allocator, AssertionProviderType>::kNone =
-        typename Statemachine<Impl, Event, Allocator, AssertionProviderType>::State("None", nullptr);
-template <typename Impl, typename Event, PolymorphicAllocatorProvider Allocator,
-          AssertionProvider AssertionProviderType>
-const typename Statemachine<Impl, Event, Allocator, AssertionProviderType>::State
-    Statemachine<Impl, Event, Allocator, AssertionProviderType>::kInTransition =
-        typename Statemachine<Impl, Event, Allocator, AssertionProviderType>::State("InTransition", nullptr);
-template <typename Impl, typename Event, PolymorphicAllocatorProvider Allocator,
-          AssertionProvider AssertionProviderType>
-const typename Statemachine<Impl, Event, Allocator, AssertionProviderType>::State
-    Statemachine<Impl, Event, Allocator, AssertionProviderType>::kDeferEvent =
-        typename Statemachine<Impl, Event, Allocator, AssertionProviderType>::State("Defer", nullptr);
+template <typename Impl, typename Event, size_t NumHistoryStates, AssertionProvider AssertionProviderType,
+          typename Hooks>
+const typename Statemachine<Impl, Event, NumHistoryStates, AssertionProviderType, Hooks>::State
+    Statemachine<Impl, Event, NumHistoryStates, AssertionProviderType, Hooks>::kNone =
+        typename Statemachine<Impl, Event, NumHistoryStates, AssertionProviderType, Hooks>::State("None", nullptr);
+template <typename Impl, typename Event, size_t NumHistoryStates, AssertionProvider AssertionProviderType,
+          typename Hooks>
+const typename Statemachine<Impl, Event, NumHistoryStates, AssertionProviderType, Hooks>::State
+    Statemachine<Impl, Event, NumHistoryStates, AssertionProviderType, Hooks>::kInTransition =
+        typename Statemachine<Impl, Event, NumHistoryStates, AssertionProviderType, Hooks>::State("InTransition",
+                                                                                                nullptr);
+template <typename Impl, typename Event, size_t NumHistoryStates, AssertionProvider AssertionProviderType,
+          typename Hooks>
+const typename Statemachine<Impl, Event, NumHistoryStates, AssertionProviderType, Hooks>::State
+    Statemachine<Impl, Event, NumHistoryStates, AssertionProviderType, Hooks>::kDeferEvent =
+        typename Statemachine<Impl, Event, NumHistoryStates, AssertionProviderType, Hooks>::State("Defer", nullptr);
 } // namespace cpp_event_framework
@@ -0,0 +1,293 @@
+/**
+ * @file StatemachineFleet.hxx
+ * @author Dirk Ziegelmeier (dirk@ziegelmeier.net)
+ * @brief
+ * @date 16-10-2026
+ *
+ * @copyright SPDX-License-Identifier: Apache-2.0
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include <cpp_event_framework/Statemachine.hxx>
+
+namespace cpp_event_framework
+{
+/**
+ * @brief Container for many instances of the same statemachine type (e.g. one per connection).
+ * Per instance, only a one byte state index and one byte per used history state are stored, in
+ * structure-of-arrays layout. Implementation pointer, name and hooks are shared by all instances of the fleet.
+ * Events are processed by a single shared statemachine object that is loaded with the instance state,
+ * so all Statemachine semantics (hierarchy, history, hooks, deferral) apply unchanged.
+ * Handlers, actions and hooks can use CurrentInstance() to find out which instance is being processed.
+ * State indices are assigned per fleet in order of first use, max. 255 different states per fleet.
+ * A fleet is not thread-safe: all calls must be made from one thread at a time. Different fleets of the same
+ * statemachine type are independent and may be used from different threads.
+ *
+ * @tparam FsmType Statemachine type (Statemachine or class derived from it)
+ */
+template <typename FsmType>
+class StatemachineFleet
+{
+public:
+    /**
+     * @brief Statemachine type
+     */
+    using Fsm = FsmType;
+
+    /**
+     * @brief Instance identifier, instances are numbered consecutively starting at 0
+     */
+    using InstanceId = size_t;
+
+    /**
+     * @brief Fleet is not dispatching an event
+     */
+    static constexpr InstanceId kNoInstance = static_cast<InstanceId>(-1);
+
+    /**
+     * @brief Construct a new fleet
+     *
+     * @param impl Statemachine implementation, shared by all instances
+     * @param name Fleet name, useful for logging
+     */
+    StatemachineFleet(typename Fsm::ImplPtr impl, const char* name)
+    {
+        machine_.Init(impl, name);
+    }
+
+    /**
+     * @brief Shared statemachine object, e.g. to assign hooks (on_state_entry_ etc.) for all instances.
+     * Do not call React()/Start() on it directly.
+     *
+     * @return Fsm&
+     */
+    Fsm& Machine()
+    {
+        return machine_;
+    }
+
+    /**
+     * @brief Reserve memory for instances
+     *
+     * @param count Number of instances
+     */
+    void Reserve(size_t count)
+    {
+        states_.reserve(count);
+    }
+
+    /**
+     * @brief Add an instance and enter its initial state
+     *
+     * @param initial Initial state
+     * @return InstanceId
+     */
+    InstanceId Add(typename Fsm::StatePtr initial)
+    {
+        const InstanceId id = states_.size();
+        states_.emplace_back(0);
+
+        // Nothing loaded: Store() writes state and history of the new instance
+        current_instance_ = id;
+        loaded_state_ = nullptr;
+        loaded_history_.fill(nullptr);
+        Base().Start(initial);
+        Store(id);
+        current_instance_ = kNoInstance;
+
+        return id;
+    }
+
+    /**
+     * @brief Synchronously react to an event
+     *
+     * @param id Instance
+     * @param event Event
+     */
+    void React(InstanceId id, typename Fsm::Event event)
+    {
+        current_instance_ = id;
+        Load(id);
+        Base().React(event);
+        Store(id);
+        current_instance_ = kNoInstance;
+    }
+
+    /**
+     * @brief Send an event to all instances that are in a state (or one of its substates).
+     * Scans the contiguous state index array. Per instance, only state and history entries that changed are
+     * written back.
+     *
+     * @param state State
+     * @param event Event
+     * @return size_t Number of instances that received the event
+     */
+    size_t ReactAllInState(typename Fsm::StateRef state, typename Fsm::Event event)
+    {
+        const auto mask = StateMask(state);
+        size_t count = 0;
+        for (InstanceId id = 0; id < states_.size(); id++)
+        {
+            if (mask.at(states_[id]))
+            {
+                React(id, event);
+                count++;
+            }
+        }
+        return count;
+    }
+
+    /**
+     * @brief Count instances that are in a state (or one of its substates)
+     *
+     * @param state State
+     * @return size_t
+     */
+    [[nodiscard]] size_t CountInState(typename Fsm::StateRef state) const
+    {
+        const auto mask = StateMask(state);
+        size_t count = 0;
+        for (const auto index : states_)
+        {
+            count += mask.at(index) ? 1U : 0U;
+        }
+        return count;
+    }
+
+    /**
+     * @brief Current state of an instance
+     *
+     * @param id Instance
+     * @return Fsm::StatePtr
+     */
+    [[nodiscard]] typename Fsm::StatePtr CurrentState(InstanceId id) const
+    {
+        return IndexedState(states_.at(id));
+    }
+
+    /**
+     * @brief Instance currently processing an event (kNoInstance outside of React()/Add())
+     *
+     * @return InstanceId
+     */
+    [[nodiscard]] InstanceId CurrentInstance() const
+    {
+        return current_instance_;
+    }
+
+    /**
+     * @brief Number of instances
+     *
+     * @return size_t
+     */
+    [[nodiscard]] size_t Size() const
+    {
+        return states_.size();
+    }
+
+private:
+    // Statemachine base class, members used here are private to it
+    using BaseType = std::remove_cvref_t<typename Fsm::Ref>;
+
+    // State indices are stored in one byte per instance
+    static constexpr size_t kMaxStates = 255;
+
+    Fsm machine_;
+    InstanceId current_instance_ = kNoInstance;
+    // State per state index, indices are assigned on first use
+    std::vector<typename Fsm::StatePtr> indexed_states_;
+    // State index per instance
+    std::vector<uint8_t> states_;
+    // Per history slot: state index + 1 per instance (0: no history), grown when a history is stored
+    std::array<std::vector<uint8_t>, Fsm::kNumHistoryStates> history_;
+    // State and history set by Load(), Store() only writes back what changed
+    typename Fsm::StatePtr loaded_state_ = nullptr;
+    std::array<typename Fsm::StatePtr, Fsm::kNumHistoryStates> loaded_history_ = {};
+
+    BaseType& Base()
+    {
+        return machine_;
+    }
+
+    uint8_t StateIndex(typename Fsm::StatePtr state)
+    {
+        const auto known = std::ranges::find(indexed_states_, state);
+        if (known != indexed_states_.end())
+        {
+            return static_cast<uint8_t>(known - indexed_states_.begin());
+        }
+
+        BaseType::FleetAssertionProvider::Assert(indexed_states_.size() < kMaxStates);
+        indexed_states_.push_back(state);
+        return static_cast<uint8_t>(indexed_states_.size() - 1);
+    }
+
+    [[nodiscard]] typename Fsm::StatePtr IndexedState(uint8_t index) const
+    {
+        return indexed_states_.at(index);
+    }
+
+    void Load(InstanceId id)
+    {
+        auto& base = Base();
+        loaded_state_ = IndexedState(states_.at(id));
+        base.current_state_ = loaded_state_;
+
+        const size_t num_slots = BaseType::num_history_slots_.load(std::memory_order_acquire);
+        for (size_t slot = 0; slot < num_slots; slot++)
+        {
+            const auto& column = history_.at(slot);
+            const uint8_t index = (id < column.size()) ? column[id] : 0;
+            loaded_history_.at(slot) = (index != 0) ? IndexedState(static_cast<uint8_t>(index - 1)) : nullptr;
+            base.history_.at(slot) = loaded_history_.at(slot);
+        }
+    }
+
+    void Store(InstanceId id)
+    {
+        auto& base = Base();
+        if (base.current_state_ != loaded_state_)
+        {
+            states_.at(id) = StateIndex(base.current_state_);
+        }
+
+        const size_t num_slots = BaseType::num_history_slots_.load(std::memory_order_acquire);
+        for (size_t slot = 0; slot < num_slots; slot++)
+        {
+            const auto* state = base.history_.at(slot);
+            if (state == loaded_history_.at(slot))
+            {
+                continue;
+            }
+            auto& column = history_.at(slot);
+            if (column.size() <= id)
+            {
+                column.resize(states_.size());
+            }
+            column[id] = (state != nullptr) ? static_cast<uint8_t>(StateIndex(state) + 1) : 0;
+        }
+    }
+
+    // Per state index: true if state is (a substate of) the given state
+    [[nodiscard]] std::array<bool, kMaxStates> StateMask(typename Fsm::StateRef state) const
+    {
+        std::array<bool, kMaxStates> mask = {};
+        const size_t level = state.Depth() - 1;
+        for (size_t index = 0; index < indexed_states_.size(); index++)
+        {
+            const auto* candidate = indexed_states_[index];
+            mask.at(index) = (candidate->Depth() > level) && (candidate->Ancestor(level) == &state);
+        }
+        return mask;
+    }
+};
+} // namespace cpp_event_framework
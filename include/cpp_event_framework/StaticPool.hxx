@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
@@ -30,9 +31,11 @@ namespace cpp_event_framework
  * @tparam MutexType Mutex type to use - e.g. to be able to supply own RT-capable implementation.
  *         NamedRequirements: DefaultConstructible, Destructible, BasicLockable
  * @tparam Alignment Alignment requirement
+ * @tparam LockFree Use a lock-free free list (ABA-safe tagged index Treiber stack) instead of MutexType
  */
 template <uint32_t NumElements, size_t ElemSize, Mutex MutexType = std::mutex,
-          AssertionProvider AssertionProviderType = DefaultAssertionProvider, size_t Alignment = sizeof(uint64_t)>
+          AssertionProvider AssertionProviderType = DefaultAssertionProvider, size_t Alignment = sizeof(uint64_t),
+          bool LockFree = false>
 class StaticPool final : public std::pmr::memory_resource
 {
 private:
@@ -43,15 +46,72 @@ private:
         {
             std::array<uint64_t, kAlignedElementSize / sizeof(uint64_t)> element;
             QueueElement* next;
+            uint32_t next_index;
         };
     };
 
+    // Lock-free mode: head is (tag << 32) | index, tag is incremented on every push and pop (MakeHead()) to avoid ABA
+    static constexpr uint32_t kNoElement = NumElements;
+
     std::array<QueueElement, NumElements> pool_mem_ = {};
     MutexType mutex_;
     QueueElement* first_ = nullptr;
+    std::atomic<uint64_t> head_ = 0;
     const char* name_ = nullptr;
     std::atomic<size_t> fill_level_ = NumElements;
 
+    static uint32_t HeadIndex(uint64_t head)
+    {
+        return static_cast<uint32_t>(head);
+    }
+
+    static uint64_t MakeHead(uint64_t previous_head, uint32_t index)
+    {
+        return (((previous_head >> 32) + 1) << 32) | index;
+    }
+
+    void* AllocateLockFree()
+    {
+        auto head = head_.load(std::memory_order_acquire);
+        while (true)
+        {
+            const auto index = HeadIndex(head);
+            if (index == kNoElement)
+            {
+                AssertionProviderType::Assert(false);
+                return nullptr;
+            }
+
+            // Element may concurrently be popped and overwritten by another thread - the CAS fails then
+            auto& element = pool_mem_.at(index);
+            const auto next = std::atomic_ref<uint32_t>(element.next_index).load(std::memory_order_relaxed);
+            if (head_.compare_exchange_weak(head, MakeHead(head, next), std::memory_order_acquire,
+                                            std::memory_order_acquire))
+            {
+                fill_level_--;
+                return &element;
+            }
+        }
+    }
+
+    void DeallocateLockFree(QueueElement* ptr)
+    {
+        const auto index = static_cast<uint32_t>(ptr - pool_mem_.data());
+        AssertionProviderType::Assert(index < NumElements);
+
+        // Count the element before publishing it and uncount it only after it was taken (AllocateLockFree()),
+        // so fill_level_ never drops below the number of free elements and never exceeds NumElements
+        const auto previous_fill_level = fill_level_.fetch_add(1);
+        AssertionProviderType::Assert(previous_fill_level < NumElements);
+
+        auto head = head_.load(std::memory_order_relaxed);
+        do
+        {
+            std::atomic_ref<uint32_t>(ptr->next_index).store(HeadIndex(head), std::memory_order_relaxed);
+        } while (!head_.compare_exchange_weak(head, MakeHead(head, index), std::memory_order_release,
+                                              std::memory_order_relaxed));
+    }
+
 public:
     /**
      * @brief Construct a new Pool object
@@ -60,11 +120,22 @@ public:
      */
     explicit StaticPool(const char* name) : first_(&pool_mem_.at(0)), name_(name)
     {
-        auto prev = first_;
-        for (size_t i = 1; i < NumElements; i++)
+        if constexpr (LockFree)
+        {
+            for (uint32_t i = 0; i < NumElements; i++)
+            {
+                pool_mem_.at(i).next_index = i + 1;
+            }
+            head_ = 0;
+        }
+        else
         {
-            prev->next = &pool_mem_.at(i);
-            prev = prev->next;
+            auto prev = first_;
+            for (size_t i = 1; i < NumElements; i++)
+            {
+                prev->next = &pool_mem_.at(i);
+                prev = prev->next;
+            }
         }
     }
 
@@ -82,6 +153,11 @@ public:
     {
         AssertionProviderType::Assert(bytes <= kAlignedElementSize);
 
+        if constexpr (LockFree)
+        {
+            return AllocateLockFree();
+        }
+
         std::scoped_lock lock(mutex_);
         AssertionProviderType::Assert(FillLevel() != 0);
 
@@ -98,6 +174,12 @@ public:
     {
         auto ptr = static_cast<QueueElement*>(p);
 
+        if constexpr (LockFree)
+        {
+            DeallocateLockFree(ptr);
+            return;
+        }
+
         std::scoped_lock lock(mutex_);
         ptr->next = first_;
         first_ = ptr;
@@ -0,0 +1,530 @@
+/**
+ * @file StaticStatemachine.hxx
+ * @author Dirk Ziegelmeier (dirk@ziegelmeier.net)
+ * @brief
+ * @date 16-10-2026
+ *
+ * @copyright SPDX-License-Identifier: Apache-2.0
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <cpp_event_framework/Concepts.hxx>
+
+namespace cpp_event_framework
+{
+/**
+ * @brief Base for state types of a StaticStatemachine. A state type declares which implementation functions it
+ * uses by hiding kHasHandler, kHasEntry and kHasExit, StaticStatemachine checks this at compile time.
+ *
+ * @tparam ParentState Parent state type, void for top-level states
+ * @tparam InitialState Initial substate type, void if there is none
+ */
+template <typename ParentState = void, typename InitialState = void>
+struct StaticState
+{
+    /**
+     * @brief Parent state type (void: top-level state)
+     */
+    using Parent = ParentState;
+    /**
+     * @brief Initial substate type (void: none)
+     */
+    using Initial = InitialState;
+    /**
+     * @brief Implementation provides Handle(State, Event). false: state passes all events to its parent
+     */
+    static constexpr bool kHasHandler = true;
+    /**
+     * @brief Implementation provides Entry(State, Event)
+     */
+    static constexpr bool kHasEntry = false;
+    /**
+     * @brief Implementation provides Exit(State, Event)
+     */
+    static constexpr bool kHasExit = false;
+};
+
+/**
+ * @brief List of all state types of a StaticStatemachine
+ */
+template <typename... States>
+struct StaticStates
+{
+};
+
+template <typename ImplType, typename EventType, typename StateList,
+          AssertionProvider AssertionProviderType = DefaultAssertionProvider>
+class StaticStatemachine;
+
+/**
+ * @brief Statemachine where states and hierarchy are types. All state relations and transition paths are resolved
+ * at compile time, React() compiles to a switch over the current state with handlers and entry/exit actions
+ * inlined. Vocabulary (TransitionTo, NoTransition, UnhandledEvent, DeferEvent) is the same as in Statemachine.
+ *
+ * Each state is a type derived from StaticState<Parent, Initial> with a static constexpr const char* kName.
+ * The implementation provides, per state:
+ *     Transition Handle(StateType, Event event);  // unless state sets kHasHandler = false
+ *     void Entry(StateType, Event event);         // if state sets kHasEntry = true
+ *     void Exit(StateType, Event event);          // if state sets kHasExit = true
+ * A missing, inaccessible or mismatching function and a function the state does not declare are compile errors.
+ * States with kHasHandler = false pass all events to their parent. Optional implementation callbacks:
+ *     void OnUnhandledEvent(Event event);
+ *     void OnDeferEvent(Event event);
+ * If these functions are private, StaticStatemachine must be a friend of the implementation.
+ * History states are not supported.
+ *
+ * @tparam ImplType Statemachine implementation type
+ * @tparam EventType Event type
+ * @tparam States State types
+ * @tparam AssertionProviderType Assertion provider
+ */
+template <typename ImplType, typename EventType, typename... States, AssertionProvider AssertionProviderType>
+class StaticStatemachine<ImplType, EventType, StaticStates<States...>, AssertionProviderType>
+{
+public:
+    /**
+     * @brief Statemachine implementation type
+     */
+    using Impl = ImplType;
+    /**
+     * @brief Statemachine implementation pointer type
+     */
+    using ImplPtr = ImplType*;
+    /**
+     * @brief Statemachine event type
+     */
+    using Event = EventType;
+    /**
+     * @brief Transition action type
+     */
+    using ActionType = void (ImplType::*)(Event);
+
+    /**
+     * @brief Number of states
+     */
+    static constexpr size_t kNumStates = sizeof...(States);
+
+    static_assert(kNumStates > 0);
+    static_assert(kNumStates < 253, "State index is stored as uint8_t, three values are reserved");
+
+    /**
+     * @brief Invalid state index
+     */
+    static constexpr uint8_t kNoState = 255;
+
+    /**
+     * @brief Index of a state type
+     */
+    template <typename State>
+    static constexpr uint8_t kIndex = []()
+    {
+        constexpr std::array<bool, kNumStates> kMatches = {std::is_same_v<State, States>...};
+        for (size_t i = 0; i < kNumStates; i++)
+        {
+            if (kMatches.at(i))
+            {
+                return static_cast<uint8_t>(i);
+            }
+        }
+        return kNoState;
+    }();
+
+    /**
+     * @brief State machine transition class, returned by Handle() functions
+     */
+    class Transition
+    {
+    private:
+        // this class is for internal use by StaticStatemachine only
+        friend class StaticStatemachine;
+
+        constexpr Transition(uint8_t target, ActionType action) : target_(target), action_(action)
+        {
+        }
+
+        uint8_t target_;
+        ActionType action_;
+    };
+
+    /**
+     * @brief Initialize statemachine with impl and name
+     *
+     * @param impl Statemachine implementation
+     * @param name Statemachine name, useful for logging
+     */
+    void Init(ImplPtr impl, const char* name)
+    {
+        AssertionProviderType::Assert(impl != nullptr);
+        name_ = name;
+        impl_ = impl;
+    }
+
+    /**
+     * @brief Start statemachine, enter initial state (and its initial substates)
+     *
+     * @tparam InitialState Initial state
+     */
+    template <typename InitialState>
+    void Start()
+    {
+        AssertionProviderType::Assert(impl_ != nullptr); // Most probably you forgot to call Init()
+        EnterPath<kNoState, kIndex<InitialState>>({});
+        EnterInitial<kIndex<InitialState>>({});
+    }
+
+    /**
+     * @brief Synchronously react to an event
+     *
+     * @param event Event
+     */
+    void React(Event event)
+    {
+        AssertionProviderType::Assert(current_ != kNoState); // Most probably you forgot to call Start()
+        AssertionProviderType::Assert(!working_);           // Most probably you are recursively calling React()
+        working_ = true;
+        ReactInCurrent(event, std::make_index_sequence<kNumStates>());
+        working_ = false;
+    }
+
+    /**
+     * @brief Check whether statemachine is in a state (or one of its substates)
+     *
+     * @tparam State State type
+     */
+    template <typename State>
+    [[nodiscard]] bool IsIn() const
+    {
+        for (auto index = current_; index != kNoState; index = kParents.at(index))
+        {
+            if (index == kIndex<State>)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Index of current state (see kIndex)
+     *
+     * @return size_t
+     */
+    [[nodiscard]] size_t CurrentStateIndex() const
+    {
+        return current_;
+    }
+
+    /**
+     * @brief Name of current state
+     *
+     * @return const char*
+     */
+    [[nodiscard]] const char* CurrentStateName() const
+    {
+        return (current_ != kNoState) ? kNames.at(current_) : "None";
+    }
+
+    /**
+     * @brief Implementation
+     *
+     * @return ImplPtr Implementation pointer
+     */
+    ImplPtr Implementation() const
+    {
+        return impl_;
+    }
+
+    /**
+     * @brief Returns name
+     *
+     * @return const char* Statemachine name
+     */
+    [[nodiscard]] const char* Name() const
+    {
+        return name_;
+    }
+
+    /**
+     * @brief Event was not handled in this state, shall be passed to parent state
+     *
+     * @return Transition
+     */
+    static constexpr Transition UnhandledEvent()
+    {
+        return Transition(kUnhandled, nullptr);
+    }
+
+    /**
+     * @brief Defer event, implementation's OnDeferEvent() is called
+     *
+     * @return Transition
+     */
+    static constexpr Transition DeferEvent()
+    {
+        return Transition(kDefer, nullptr);
+    }
+
+    /**
+     * @brief Event was handled, but no transition shall be executed, with optional action
+     *
+     * @param action Action to execute
+     * @return Transition
+     */
+    static constexpr Transition NoTransition(ActionType action = nullptr)
+    {
+        return Transition(kNoState, action);
+    }
+
+    /**
+     * @brief Create transition to target state, with optional action
+     *
+     * @tparam Target Target state type
+     * @param action Action to execute on transition
+     * @return Transition
+     */
+    template <typename Target>
+    static constexpr Transition TransitionTo(ActionType action = nullptr)
+    {
+        static_assert(kIndex<Target> != kNoState, "Target is not a state of this statemachine");
+        return Transition(kIndex<Target>, action);
+    }
+
+    /**
+     * @brief Stream operator for logging
+     */
+    friend std::ostream& operator<<(std::ostream& os, const StaticStatemachine& sm)
+    {
+        return os << sm.Name();
+    }
+
+private:
+    static constexpr uint8_t kUnhandled = 254;
+    static constexpr uint8_t kDefer = 253;
+
+    template <typename State>
+    static constexpr uint8_t IndexOrNone()
+    {
+        if constexpr (std::is_void_v<State>)
+        {
+            return kNoState;
+        }
+        else
+        {
+            return kIndex<State>;
+        }
+    }
+
+    static constexpr std::array<uint8_t, kNumStates> kParents = {IndexOrNone<typename States::Parent>()...};
+    static constexpr std::array<uint8_t, kNumStates> kInitials = {IndexOrNone<typename States::Initial>()...};
+    static constexpr std::array<const char*, kNumStates> kNames = {States::kName...};
+
+    template <size_t Index>
+    using StateAt = std::tuple_element_t<Index, std::tuple<States...>>;
+
+    static constexpr bool IsAncestorOrSelf(uint8_t ancestor, uint8_t state)
+    {
+        for (auto index = state; index != kNoState; index = kParents.at(index))
+        {
+            if (index == ancestor)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static constexpr uint8_t CommonParent(uint8_t state1, uint8_t state2)
+    {
+        for (auto index = state1; index != kNoState; index = kParents.at(index))
+        {
+            if (IsAncestorOrSelf(index, state2))
+            {
+                return index;
+            }
+        }
+        return kNoState;
+    }
+
+    uint8_t current_ = kNoState;
+    bool working_ = false;
+    ImplPtr impl_ = nullptr;
+    const char* name_ = nullptr;
+
+    template <size_t... Indices>
+    void ReactInCurrent(Event event, std::index_sequence<Indices...> /*indices*/)
+    {
+        // Compiles to a switch over the current state
+        (void)(((current_ == Indices) && (ReactIn<Indices>(event), true)) || ...);
+    }
+
+    template <uint8_t Current>
+    void ReactIn(Event event)
+    {
+        const auto transition = HandleFrom<Current>(event);
+        switch (transition.target_)
+        {
+        case kUnhandled:
+            if constexpr (requires { impl_->OnUnhandledEvent(event); })
+            {
+                impl_->OnUnhandledEvent(event);
+            }
+            break;
+        case kDefer:
+            if constexpr (requires { impl_->OnDeferEvent(event); })
+            {
+                impl_->OnDeferEvent(event);
+            }
+            else
+            {
+                // Implementation does not support deferred events
+                AssertionProviderType::Assert(false);
+            }
+            break;
+        case kNoState:
+            if (transition.action_ != nullptr)
+            {
+                (impl_->*transition.action_)(event);
+            }
+            break;
+        default:
+            TransitionFrom<Current>(transition, event, std::make_index_sequence<kNumStates>());
+            break;
+        }
+    }
+
+    // Pass event to state, then up the hierarchy until it is handled
+    template <uint8_t Index>
+    Transition HandleFrom(Event event)
+    {
+        using State = StateAt<Index>;
+        auto transition = UnhandledEvent();
+        if constexpr (State::kHasHandler)
+        {
+            static_assert(requires { impl_->Handle(State{}, event); },
+                          "No accessible Transition Handle(State, Event), or set kHasHandler = false in the state");
+            transition = impl_->Handle(State{}, event);
+        }
+        else
+        {
+            static_assert(!requires { impl_->Handle(State{}, event); },
+                          "Handle(State, Event) would be ignored, state sets kHasHandler = false");
+        }
+        if constexpr (kParents.at(Index) != kNoState)
+        {
+            if (transition.target_ == kUnhandled)
+            {
+                return HandleFrom<kParents.at(Index)>(event);
+            }
+        }
+        return transition;
+    }
+
+    template <uint8_t From, size_t... Indices>
+    void TransitionFrom(Transition transition, Event event, std::index_sequence<Indices...> /*indices*/)
+    {
+        (void)(((transition.target_ == Indices) && (Execute<From, Indices>(transition, event), true)) || ...);
+    }
+
+    // Complete transition, exit and entry sequences are resolved at compile time
+    template <uint8_t From, uint8_t To>
+    void Execute(Transition transition, Event event)
+    {
+        constexpr uint8_t kCommonParent = CommonParent(From, To);
+
+        current_ = kNoState;
+        if constexpr (From == kCommonParent)
+        {
+            CallExit<From>(event);
+        }
+        else
+        {
+            ExitUpTo<From, kCommonParent>(event);
+        }
+
+        if (transition.action_ != nullptr)
+        {
+            (impl_->*transition.action_)(event);
+        }
+
+        EnterPath<kCommonParent, To>(event);
+        EnterInitial<To>(event);
+    }
+
+    template <uint8_t From, uint8_t Top>
+    void ExitUpTo(Event event)
+    {
+        CallExit<From>(event);
+        if constexpr (kParents.at(From) != Top)
+        {
+            ExitUpTo<kParents.at(From), Top>(event);
+        }
+    }
+
+    // Enter all states below Top down to Target (Top is an ancestor of Target or kNoState)
+    template <uint8_t Top, uint8_t Target>
+    void EnterPath(Event event)
+    {
+        if constexpr ((Top != Target) && (kParents.at(Target) != Top))
+        {
+            EnterPath<Top, kParents.at(Target)>(event);
+        }
+        CallEntry<Target>(event);
+    }
+
+    template <uint8_t Index>
+    void EnterInitial(Event event)
+    {
+        if constexpr (kInitials.at(Index) != kNoState)
+        {
+            CallEntry<kInitials.at(Index)>(event);
+            EnterInitial<kInitials.at(Index)>(event);
+        }
+        else
+        {
+            current_ = Index;
+        }
+    }
+
+    template <uint8_t Index>
+    void CallEntry(Event event)
+    {
+        if constexpr (StateAt<Index>::kHasEntry)
+        {
+            static_assert(requires { impl_->Entry(StateAt<Index>{}, event); },
+                          "No accessible void Entry(State, Event), or set kHasEntry = false in the state");
+            impl_->Entry(StateAt<Index>{}, event);
+        }
+        else
+        {
+            static_assert(!requires { impl_->Entry(StateAt<Index>{}, event); },
+                          "Entry(State, Event) would be ignored, set kHasEntry = true in the state");
+        }
+    }
+
+    template <uint8_t Index>
+    void CallExit(Event event)
+    {
+        if constexpr (StateAt<Index>::kHasExit)
+        {
+            static_assert(requires { impl_->Exit(StateAt<Index>{}, event); },
+                          "No accessible void Exit(State, Event), or set kHasExit = false in the state");
+            impl_->Exit(StateAt<Index>{}, event);
+        }
+        else
+        {
+            static_assert(!requires { impl_->Exit(StateAt<Index>{}, event); },
+                          "Exit(State, Event) would be ignored, set kHasExit = true in the state");
+        }
+    }
+};
+} // namespace cpp_event_framework
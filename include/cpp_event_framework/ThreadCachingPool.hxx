@@ -0,0 +1,388 @@
+/**
+ * @file ThreadCachingPool.hxx
+ * @author Dirk Ziegelmeier (dirk@ziegelmeier.net)
+ * @brief
+ * @date 16-10-2026
+ *
+ * @copyright SPDX-License-Identifier: Apache-2.0
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+#include <cpp_event_framework/Concepts.hxx>
+
+namespace cpp_event_framework
+{
+/**
+ * @brief Per-thread cache ("magazine" layer) in front of a fixed element size pool, e.g. Pool or StaticPool.
+ * Each thread allocates from and frees to its own small free list without locking. A thread-local list that runs
+ * empty is refilled with a full magazine of MagazineSize elements from a central depot, a list that overflows hands
+ * a full magazine to the depot - one depot lock per MagazineSize operations once elements circulate. Elements freed
+ * by another thread than the one that allocated them simply end up in the freeing thread's list and travel back via
+ * the depot in batches.
+ * The upstream pool is only used when the depot is empty (warm-up) and when the depot is trimmed. During warm-up
+ * each allocation goes to upstream separately (one upstream lock per element, the empty depot is not locked):
+ * upstream is not asked for whole magazines, that could drain a fixed size upstream pool into one thread's cache.
+ * Note: elements cached by threads are not reflected in the upstream pool's fill level.
+ *
+ * @tparam MagazineSize Number of elements moved between thread cache and depot at once
+ * @tparam MutexType Mutex type to use for the depot
+ */
+template <size_t MagazineSize = 32, Mutex MutexType = std::mutex,
+          AssertionProvider AssertionProviderType = DefaultAssertionProvider>
+class ThreadCachingPool final : public std::pmr::memory_resource
+{
+public:
+    /**
+     * @brief Shared pointer alias
+     */
+    using SPtr = std::shared_ptr<ThreadCachingPool>;
+
+    /**
+     * @brief Construct a new thread caching pool
+     *
+     * @param upstream Upstream pool, must outlive this object
+     * @param element_size Size of each element, must not exceed upstream element size
+     */
+    ThreadCachingPool(std::pmr::memory_resource* upstream, size_t element_size)
+        : upstream_(upstream), element_size_(element_size), id_(next_id_.fetch_add(1))
+    {
+        auto& registry = GetRegistry();
+        std::scoped_lock lock(registry.mutex);
+        registry.pools.emplace_back(id_, this);
+    }
+
+    /**
+     * @brief Construct a new thread caching pool, keeps upstream pool alive
+     *
+     * @param upstream Upstream pool
+     * @param element_size Size of each element, must not exceed upstream element size
+     */
+    ThreadCachingPool(std::shared_ptr<std::pmr::memory_resource> upstream, size_t element_size)
+        : ThreadCachingPool(upstream.get(), element_size)
+    {
+        shared_upstream_ = std::move(upstream);
+    }
+
+    /**
+     * @brief Destroy the pool. Returns the calling thread's cache and the depot to upstream.
+     * Elements still cached by other threads are NOT returned, the other threads drop their cache entry of this
+     * pool the next time they use any ThreadCachingPool.
+     */
+    ~ThreadCachingPool() override
+    {
+        {
+            auto& registry = GetRegistry();
+            std::scoped_lock lock(registry.mutex);
+            std::erase_if(registry.pools, [this](const auto& entry) { return entry.first == id_; });
+        }
+        destroyed_count_.fetch_add(1, std::memory_order_release);
+
+        if (!tls_cache_destroyed_)
+        {
+            auto& entries = tls_cache_.entries;
+            auto it = std::ranges::find_if(entries, [this](const auto& entry) { return entry.owner_id == id_; });
+            if (it != entries.end())
+            {
+                ReturnToUpstream(it->magazine.elements.data(), it->magazine.count);
+                entries.erase(it);
+            }
+        }
+        Trim();
+    }
+
+    ThreadCachingPool(const ThreadCachingPool& rhs) = delete;
+    ThreadCachingPool(ThreadCachingPool&& rhs) = delete;
+    ThreadCachingPool& operator=(const ThreadCachingPool& rhs) = delete;
+    ThreadCachingPool& operator=(ThreadCachingPool&& rhs) = delete;
+
+    /**
+     * @brief std::pmr::memory_resource::do_allocate
+     */
+    void* do_allocate(size_t bytes, size_t /*alignment*/) override
+    {
+        AssertionProviderType::Assert(bytes <= element_size_);
+
+        auto* magazine = LocalMagazine();
+        if ((magazine == nullptr) || ((magazine->count == 0) && !Refill(*magazine)))
+        {
+            return upstream_->allocate(element_size_, kAlignment);
+        }
+        return magazine->elements.at(--magazine->count);
+    }
+
+    /**
+     * @brief std::pmr::memory_resource::do_deallocate
+     */
+    void do_deallocate(void* p, size_t /*bytes*/, size_t /*alignment*/) override
+    {
+        auto* magazine = LocalMagazine();
+        if (magazine == nullptr)
+        {
+            upstream_->deallocate(p, element_size_, kAlignment);
+            return;
+        }
+        if (magazine->count == magazine->elements.size())
+        {
+            Flush(*magazine);
+        }
+        magazine->elements.at(magazine->count++) = p;
+    }
+
+    /**
+     * @brief std::pmr::memory_resource::do_is_equal
+     */
+    bool do_is_equal(const memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+
+    /**
+     * @brief Move all elements cached by the calling thread to the depot
+     */
+    void FlushThreadCache()
+    {
+        auto* magazine = LocalMagazine();
+        if (magazine != nullptr)
+        {
+            std::scoped_lock lock(mutex_);
+            DepotPut(magazine->elements.data(), magazine->count);
+            magazine->count = 0;
+        }
+    }
+
+    /**
+     * @brief Return all elements in depot to upstream pool
+     */
+    void Trim()
+    {
+        std::vector<void*> elements;
+        {
+            std::scoped_lock lock(mutex_);
+            elements.swap(depot_);
+            depot_level_.store(0, std::memory_order_relaxed);
+        }
+        ReturnToUpstream(elements.data(), elements.size());
+    }
+
+    /**
+     * @brief Number of elements in depot (not including thread caches)
+     *
+     * @return size_t
+     */
+    [[nodiscard]] size_t DepotLevel() const
+    {
+        return depot_level_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Number of elements cached by the calling thread
+     *
+     * @return size_t
+     */
+    [[nodiscard]] size_t ThreadCacheLevel()
+    {
+        auto* magazine = LocalMagazine();
+        return (magazine != nullptr) ? magazine->count : 0;
+    }
+
+    /**
+     * @brief Number of pools the calling thread has a cache entry for
+     *
+     * @return size_t
+     */
+    [[nodiscard]] static size_t NumThreadCacheEntries()
+    {
+        return tls_cache_destroyed_ ? 0 : tls_cache_.entries.size();
+    }
+
+    /**
+     * @brief Get size of pool elements
+     *
+     * @return size_t
+     */
+    [[nodiscard]] size_t ElementSize() const
+    {
+        return element_size_;
+    }
+
+    /**
+     * @brief Stream operator for logging
+     */
+    friend std::ostream& operator<<(std::ostream& ostream, ThreadCachingPool& pool)
+    {
+        return ostream << "ThreadCachingPool [depot " << pool.DepotLevel() << "]";
+    }
+
+private:
+    static constexpr size_t kAlignment = alignof(std::max_align_t);
+
+    struct Magazine
+    {
+        // Twice the magazine size: hysteresis so alternating alloc/free at a boundary does not hit the depot
+        std::array<void*, 2 * MagazineSize> elements = {};
+        size_t count = 0;
+    };
+
+    struct ThreadCacheEntry
+    {
+        uint64_t owner_id = 0;
+        Magazine magazine;
+    };
+
+    struct ThreadCache
+    {
+        std::vector<ThreadCacheEntry> entries;
+        // Value of destroyed_count_ when entries of destroyed pools were last removed
+        uint64_t purged_at = 0;
+
+        ThreadCache() = default;
+        ThreadCache(const ThreadCache& rhs) = delete;
+        ThreadCache(ThreadCache&& rhs) = delete;
+        ThreadCache& operator=(const ThreadCache& rhs) = delete;
+        ThreadCache& operator=(ThreadCache&& rhs) = delete;
+
+        // Thread exits: hand cached elements to the depots of all pools that still exist
+        ~ThreadCache()
+        {
+            tls_cache_destroyed_ = true;
+
+            auto& registry = GetRegistry();
+            std::scoped_lock lock(registry.mutex);
+            for (auto& entry : entries)
+            {
+                auto it = std::ranges::find_if(registry.pools,
+                                               [&entry](const auto& pool) { return pool.first == entry.owner_id; });
+                if (it != registry.pools.end())
+                {
+                    std::scoped_lock depot_lock(it->second->mutex_);
+                    it->second->DepotPut(entry.magazine.elements.data(), entry.magazine.count);
+                }
+            }
+        }
+    };
+
+    // Pools that are alive, used by exiting threads to return their caches
+    struct Registry
+    {
+        std::mutex mutex;
+        std::vector<std::pair<uint64_t, ThreadCachingPool*>> pools;
+    };
+
+    static inline std::atomic<uint64_t> next_id_ = 1;
+    // Number of pools destroyed so far, tells threads that their cache may contain entries of dead pools
+    static inline std::atomic<uint64_t> destroyed_count_ = 0;
+    static inline thread_local ThreadCache tls_cache_;
+    static inline thread_local bool tls_cache_destroyed_ = false;
+
+    std::pmr::memory_resource* upstream_ = nullptr;
+    std::shared_ptr<std::pmr::memory_resource> shared_upstream_;
+    size_t element_size_ = 0;
+    uint64_t id_ = 0;
+    MutexType mutex_;
+    std::vector<void*> depot_;
+    // depot_.size(), readable without mutex_ (refill skips the lock when the depot is empty)
+    std::atomic<size_t> depot_level_ = 0;
+
+    static Registry& GetRegistry()
+    {
+        // Intentionally never destroyed: pools may be destroyed during static destruction (e.g. held by a
+        // CustomAllocator)
+        static auto* registry = new Registry();
+        return *registry;
+    }
+
+    Magazine* LocalMagazine()
+    {
+        // Thread is exiting and its cache is gone already - bypass cache
+        if (tls_cache_destroyed_)
+        {
+            return nullptr;
+        }
+
+        const auto destroyed = destroyed_count_.load(std::memory_order_acquire);
+        if (tls_cache_.purged_at != destroyed)
+        {
+            PurgeDestroyedPools();
+            tls_cache_.purged_at = destroyed;
+        }
+
+        auto& entries = tls_cache_.entries;
+        for (auto& entry : entries)
+        {
+            if (entry.owner_id == id_)
+            {
+                return &entry.magazine;
+            }
+        }
+        entries.emplace_back(ThreadCacheEntry{id_, {}});
+        return &entries.back().magazine;
+    }
+
+    // Elements cached for a destroyed pool are dropped, its upstream may be gone as well
+    static void PurgeDestroyedPools()
+    {
+        auto& registry = GetRegistry();
+        std::scoped_lock lock(registry.mutex);
+        std::erase_if(tls_cache_.entries,
+                      [&registry](const auto& entry)
+                      {
+                          const auto alive = [&entry](const auto& pool) { return pool.first == entry.owner_id; };
+                          return std::ranges::none_of(registry.pools, alive);
+                      });
+    }
+
+    void DepotPut(void* const* elements, size_t count)
+    {
+        depot_.insert(depot_.end(), elements, elements + count);
+        depot_level_.store(depot_.size(), std::memory_order_relaxed);
+    }
+
+    bool Refill(Magazine& magazine)
+    {
+        // Warm-up: nothing to take, go to upstream without locking the depot. Elements put into the depot
+        // concurrently are picked up by a later refill.
+        if (depot_level_.load(std::memory_order_relaxed) == 0)
+        {
+            return false;
+        }
+
+        std::scoped_lock lock(mutex_);
+        const auto count = std::min(MagazineSize, depot_.size());
+        std::copy(depot_.end() - static_cast<std::ptrdiff_t>(count), depot_.end(), magazine.elements.begin());
+        depot_.resize(depot_.size() - count);
+        depot_level_.store(depot_.size(), std::memory_order_relaxed);
+        magazine.count = count;
+        return count != 0;
+    }
+
+    void Flush(Magazine& magazine)
+    {
+        // Hand the oldest half to the depot, the most recently freed (cache-hot) elements stay local
+        std::scoped_lock lock(mutex_);
+        DepotPut(magazine.elements.data(), MagazineSize);
+        std::copy(magazine.elements.begin() + MagazineSize, magazine.elements.end(), magazine.elements.begin());
+        magazine.count -= MagazineSize;
+    }
+
+    void ReturnToUpstream(void* const* elements, size_t count)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            upstream_->deallocate(elements[i], element_size_, kAlignment);
+        }
+    }
+};
+} // namespace cpp_event_framework
@@ -0,0 +1,466 @@
+/**
+ * @file TimingWheel.hxx
+ * @author Dirk Ziegelmeier (dirk@ziegelmeier.net)
+ * @brief
+ * @date 16-10-2026
+ *
+ * @copyright SPDX-License-Identifier: Apache-2.0
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+
+namespace cpp_event_framework
+{
+template <size_t SlotBits, size_t NumLevels>
+class TimingWheel;
+
+/**
+ * @brief Intrusive timer node, embed into (or derive from) the object to be timed.
+ * A node must stay alive as long as it is armed.
+ */
+class TimingWheelNode
+{
+public:
+    TimingWheelNode() = default;
+    ~TimingWheelNode() = default;
+
+    // Non-copyable, non-movable (linked into a wheel)
+    TimingWheelNode(const TimingWheelNode& rhs) = delete;
+    TimingWheelNode(TimingWheelNode&& rhs) = delete;
+    TimingWheelNode& operator=(const TimingWheelNode& rhs) = delete;
+    TimingWheelNode& operator=(TimingWheelNode&& rhs) = delete;
+
+    /**
+     * @brief Check whether node is armed
+     */
+    [[nodiscard]] bool IsArmed() const
+    {
+        return next_ != nullptr;
+    }
+
+    /**
+     * @brief Expiry tick, valid while armed
+     */
+    [[nodiscard]] uint64_t Expiry() const
+    {
+        return expiry_;
+    }
+
+private:
+    template <size_t SlotBits, size_t NumLevels>
+    friend class TimingWheel;
+
+    TimingWheelNode* prev_ = nullptr;
+    TimingWheelNode* next_ = nullptr;
+    uint64_t expiry_ = 0;
+
+    // Empty circular list head
+    void MakeHead()
+    {
+        prev_ = this;
+        next_ = this;
+    }
+
+    [[nodiscard]] bool Empty() const
+    {
+        return next_ == this;
+    }
+
+    void InsertBefore(TimingWheelNode* node)
+    {
+        node->prev_ = prev_;
+        node->next_ = this;
+        prev_->next_ = node;
+        prev_ = node;
+    }
+
+    void Unlink()
+    {
+        prev_->next_ = next_;
+        next_->prev_ = prev_;
+        prev_ = nullptr;
+        next_ = nullptr;
+    }
+
+    // Move all nodes of this list to (empty) list head
+    void MoveTo(TimingWheelNode& head)
+    {
+        if (Empty())
+        {
+            head.MakeHead();
+            return;
+        }
+        head.next_ = next_;
+        head.prev_ = prev_;
+        next_->prev_ = &head;
+        prev_->next_ = &head;
+        MakeHead();
+    }
+};
+
+/**
+ * @brief Hierarchical timing wheel of intrusive timer nodes. Time is measured in ticks, the wheel is driven by
+ * Advance(). Arm() and Cancel() are O(1) and never allocate.
+ * Level N has 2^SlotBits slots of 2^(SlotBits * N) ticks each. A timer is placed on the lowest level where its
+ * expiry tick only differs from the current tick in that level's bits, and moves down one or more levels when its
+ * slot becomes current ("cascading"), so timers expire exactly at their tick.
+ * Not thread-safe.
+ *
+ * @tparam SlotBits log2 of number of slots per level
+ * @tparam NumLevels Number of levels
+ */
+template <size_t SlotBits = 8, size_t NumLevels = 4>
+class TimingWheel
+{
+public:
+    static_assert(SlotBits >= 6, "Slot occupancy is stored in 64 bit words");
+    static_assert((SlotBits * NumLevels) < 64);
+
+    /**
+     * @brief Tick type
+     */
+    using Tick = uint64_t;
+
+    /**
+     * @brief Number of slots per level
+     */
+    static constexpr size_t kNumSlots = size_t(1) << SlotBits;
+
+    /**
+     * @brief Max. delay, longer delays are clamped
+     */
+    static constexpr Tick kMaxDelay = ((Tick(kNumSlots) - 1) << (SlotBits * (NumLevels - 1))) - 1;
+
+    /**
+     * @brief No timer armed
+     */
+    static constexpr Tick kNever = std::numeric_limits<Tick>::max();
+
+    /**
+     * @brief Construct a new timing wheel
+     *
+     * @param now Current tick
+     */
+    explicit TimingWheel(Tick now = 0) : now_(now)
+    {
+        for (auto& level : slots_)
+        {
+            for (auto& slot : level)
+            {
+                slot.MakeHead();
+            }
+        }
+    }
+
+    ~TimingWheel()
+    {
+        Clear();
+    }
+
+    // Non-copyable, non-movable (nodes point to slots)
+    TimingWheel(const TimingWheel& rhs) = delete;
+    TimingWheel(TimingWheel&& rhs) = delete;
+    TimingWheel& operator=(const TimingWheel& rhs) = delete;
+    TimingWheel& operator=(TimingWheel&& rhs) = delete;
+
+    /**
+     * @brief Current tick
+     */
+    [[nodiscard]] Tick Now() const
+    {
+        return now_;
+    }
+
+    /**
+     * @brief Number of armed nodes
+     */
+    [[nodiscard]] size_t Size() const
+    {
+        return size_;
+    }
+
+    /**
+     * @brief Check whether no node is armed
+     */
+    [[nodiscard]] bool Empty() const
+    {
+        return size_ == 0;
+    }
+
+    /**
+     * @brief Arm a node, re-arms it when it is already armed
+     *
+     * @param node Node
+     * @param delay Delay in ticks relative to Now(), at least 1, at most kMaxDelay
+     */
+    void Arm(TimingWheelNode& node, Tick delay)
+    {
+        Cancel(node);
+        node.expiry_ = now_ + std::clamp<Tick>(delay, 1, kMaxDelay);
+        Insert(&node);
+        size_++;
+    }
+
+    /**
+     * @brief Disarm a node
+     *
+     * @param node Node
+     * @return true Node was armed
+     */
+    bool Cancel(TimingWheelNode& node)
+    {
+        if (!node.IsArmed())
+        {
+            return false;
+        }
+        Unlink(&node);
+        size_--;
+        return true;
+    }
+
+    /**
+     * @brief Disarm all nodes
+     */
+    void Clear()
+    {
+        Clear([](TimingWheelNode& /*node*/) {});
+    }
+
+    /**
+     * @brief Disarm all nodes and call a function for each of them
+     *
+     * @param on_cancelled Called with TimingWheelNode&
+     */
+    template <typename Callback>
+    void Clear(Callback&& on_cancelled)
+    {
+        for (size_t level = 0; level < NumLevels; level++)
+        {
+            for (size_t slot = 0; slot < kNumSlots; slot++)
+            {
+                auto& head = slots_.at(level).at(slot);
+                while (!head.Empty())
+                {
+                    auto* node = head.next_;
+                    node->Unlink();
+                    on_cancelled(*node);
+                }
+            }
+            occupied_.at(level) = {};
+        }
+        size_ = 0;
+    }
+
+    /**
+     * @brief Tick at which the wheel has work to do next (a node expires or a slot cascades).
+     * Never later than the earliest expiry.
+     *
+     * @return Tick kNever if no node is armed
+     */
+    [[nodiscard]] Tick NextEventTick() const
+    {
+        Tick result = kNever;
+        for (size_t level = 0; level < NumLevels; level++)
+        {
+            const size_t shift = SlotBits * level;
+            const size_t current = SlotIndex(now_, level);
+            const size_t slot = NextOccupied(level, current + 1);
+            if (slot == kNumSlots)
+            {
+                continue;
+            }
+
+            // Start of the slot's range in the current (or, on the top level, next) revolution
+            const Tick revolution = Tick(1) << (shift + SlotBits);
+            Tick tick = (now_ & ~(revolution - 1)) + (Tick(slot) << shift);
+            if (tick <= now_)
+            {
+                tick += revolution;
+            }
+            result = std::min(result, tick);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Advance wheel to a tick and call a function for each expired node.
+     * Expired nodes are disarmed before the call, the function may arm or cancel any node.
+     *
+     * @param now Tick to advance to, ignored if not later than Now()
+     * @param on_expired Called with TimingWheelNode&
+     * @return size_t Number of expired nodes
+     */
+    template <typename Callback>
+    size_t Advance(Tick now, Callback&& on_expired)
+    {
+        size_t count = 0;
+        while (now_ < now)
+        {
+            // Skip ticks where nothing happens
+            const Tick next = NextEventTick();
+            if (next > now)
+            {
+                now_ = now;
+                break;
+            }
+            now_ = next;
+
+            Cascade();
+            count += Expire(on_expired);
+        }
+        return count;
+    }
+
+private:
+    static constexpr size_t kWordsPerLevel = kNumSlots / 64;
+
+    std::array<std::array<TimingWheelNode, kNumSlots>, NumLevels> slots_;
+    std::array<std::array<uint64_t, kWordsPerLevel>, NumLevels> occupied_ = {};
+    Tick now_;
+    size_t size_ = 0;
+
+    static size_t SlotIndex(Tick tick, size_t level)
+    {
+        return static_cast<size_t>(tick >> (SlotBits * level)) & (kNumSlots - 1);
+    }
+
+    // Lowest level on which expiry and now_ differ
+    size_t Level(Tick expiry) const
+    {
+        const Tick diff = (expiry ^ now_) >> SlotBits;
+        const auto level = static_cast<size_t>(std::bit_width(diff) + SlotBits - 1) / SlotBits;
+        return std::min(level, NumLevels - 1);
+    }
+
+    void Insert(TimingWheelNode* node)
+    {
+        const size_t level = Level(node->expiry_);
+        const size_t slot = SlotIndex(node->expiry_, level);
+        slots_.at(level).at(slot).InsertBefore(node);
+        occupied_.at(level).at(slot / 64) |= uint64_t(1) << (slot % 64);
+    }
+
+    void Unlink(TimingWheelNode* node)
+    {
+        // Node may be in a slot or in the list of nodes being expired - clear slot bit when slot becomes empty
+        const bool last = (node->prev_ == node->next_);
+        auto* head = node->next_;
+        node->Unlink();
+        if (last)
+        {
+            UpdateOccupied(head);
+        }
+    }
+
+    void UpdateOccupied(const TimingWheelNode* head)
+    {
+        for (size_t level = 0; level < NumLevels; level++)
+        {
+            const auto& level_slots = slots_.at(level);
+            const std::less<const TimingWheelNode*> less;
+            if (!less(head, level_slots.data()) && less(head, level_slots.data() + kNumSlots))
+            {
+                const auto slot = static_cast<size_t>(head - level_slots.data());
+                occupied_.at(level).at(slot / 64) &= ~(uint64_t(1) << (slot % 64));
+                return;
+            }
+        }
+    }
+
+    // First occupied slot >= from, kNumSlots if none
+    size_t NextOccupied(size_t level, size_t from) const
+    {
+        const auto& words = occupied_.at(level);
+        for (size_t word = from / 64; word < kWordsPerLevel; word++)
+        {
+            uint64_t bits = words.at(word);
+            if (word == from / 64)
+            {
+                bits &= ~uint64_t(0) << (from % 64);
+            }
+            if (bits != 0)
+            {
+                return (word * 64) + static_cast<size_t>(std::countr_zero(bits));
+            }
+        }
+
+        // Top level wraps around (expiry beyond current revolution)
+        if (level == NumLevels - 1)
+        {
+            for (size_t word = 0; word <= (from - 1) / 64 && word < kWordsPerLevel; word++)
+            {
+                if (words.at(word) != 0)
+                {
+                    return (word * 64) + static_cast<size_t>(std::countr_zero(words.at(word)));
+                }
+            }
+        }
+        return kNumSlots;
+    }
+
+    // Re-insert nodes of slots that became current, highest level first
+    void Cascade()
+    {
+        for (size_t level = NumLevels - 1; level > 0; level--)
+        {
+            const Tick mask = (Tick(1) << (SlotBits * level)) - 1;
+            if ((now_ & mask) != 0)
+            {
+                continue;
+            }
+
+            const size_t slot = SlotIndex(now_, level);
+            auto& head = slots_.at(level).at(slot);
+            if (head.Empty())
+            {
+                continue;
+            }
+            occupied_.at(level).at(slot / 64) &= ~(uint64_t(1) << (slot % 64));
+
+            TimingWheelNode pending;
+            head.MoveTo(pending);
+            while (!pending.Empty())
+            {
+                auto* node = pending.next_;
+                node->Unlink();
+                Insert(node);
+            }
+        }
+    }
+
+    template <typename Callback>
+    size_t Expire(Callback& on_expired)
+    {
+        const size_t slot = SlotIndex(now_, 0);
+        auto& head = slots_.at(0).at(slot);
+        if (head.Empty())
+        {
+            return 0;
+        }
+        occupied_.at(0).at(slot / 64) &= ~(uint64_t(1) << (slot % 64));
+
+        // Nodes may be cancelled or re-armed by callback, they are unlinked from "pending" then
+        TimingWheelNode pending;
+        head.MoveTo(pending);
+        size_t count = 0;
+        while (!pending.Empty())
+        {
+            auto* node = pending.next_;
+            node->Unlink();
+            size_--;
+            count++;
+            on_expired(*node);
+        }
+        return count;
+    }
+};
+} // namespace cpp_event_framework
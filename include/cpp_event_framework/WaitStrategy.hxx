@@ -0,0 +1,243 @@
+/**
+ * @file WaitStrategy.hxx
+ * @author Dirk Ziegelmeier (dirk@ziegelmeier.net)
+ * @brief
+ * @date 16-10-2026
+ *
+ * @copyright SPDX-License-Identifier: Apache-2.0
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <semaphore>
+
+#include <cpp_event_framework/SpscRing.hxx>
+
+namespace cpp_event_framework
+{
+/**
+ * @brief Tell the CPU that the caller is busy-waiting
+ */
+inline void CpuRelax()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+/**
+ * @brief Wait strategy "busy poll": counting semaphore that never sleeps. acquire() spins until a count is
+ * available, release() never makes a system call. Lowest wakeup latency, but the consumer burns a core while its
+ * queue is empty.
+ * Wait strategies are used as SemaphoreType of an event queue, e.g.
+ * cpp_active_objects::EventQueue<cpp_event_framework::BusyPollSemaphore>
+ */
+class BusyPollSemaphore
+{
+public:
+    /**
+     * @brief Constructor
+     *
+     * @param desired Initial count
+     */
+    explicit BusyPollSemaphore(std::ptrdiff_t desired) : count_(desired)
+    {
+        assert(desired >= 0);
+    }
+
+    ~BusyPollSemaphore() = default;
+
+    // Non-copyable, non-movable
+    BusyPollSemaphore(const BusyPollSemaphore& rhs) = delete;
+    BusyPollSemaphore(BusyPollSemaphore&& rhs) = delete;
+    BusyPollSemaphore& operator=(const BusyPollSemaphore& rhs) = delete;
+    BusyPollSemaphore& operator=(BusyPollSemaphore&& rhs) = delete;
+
+    /**
+     * @brief Increment count
+     */
+    void release()
+    {
+        count_.fetch_add(1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Decrement count, spin while it is zero
+     */
+    void acquire()
+    {
+        while (!try_acquire())
+        {
+            CpuRelax();
+        }
+    }
+
+    /**
+     * @brief Decrement count if it is not zero
+     *
+     * @return true Count was decremented
+     */
+    bool try_acquire()
+    {
+        auto count = count_.load(std::memory_order_relaxed);
+        while (count > 0)
+        {
+            if (count_.compare_exchange_weak(count, count - 1, std::memory_order_acquire, std::memory_order_relaxed))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Decrement count, spin while it is zero until deadline has passed
+     *
+     * @param deadline
+     * @return true Count was decremented, false: timeout
+     */
+    template <typename Clock, typename Duration>
+    bool try_acquire_until(const std::chrono::time_point<Clock, Duration>& deadline)
+    {
+        while (!try_acquire())
+        {
+            if (Clock::now() >= deadline)
+            {
+                return false;
+            }
+            CpuRelax();
+        }
+        return true;
+    }
+
+private:
+    alignas(kCacheLineSize) std::atomic<std::ptrdiff_t> count_;
+};
+
+/**
+ * @brief Wait strategy "spin, then park": counting semaphore that spins up to SpinCount times before the waiter
+ * parks on a futex-based semaphore. A negative count is the number of parked waiters - release() only makes the
+ * wake system call when a waiter is parked, producers skip it while the consumer is awake.
+ *
+ * @tparam SpinCount Number of polls before parking
+ */
+template <size_t SpinCount = 4000>
+class SpinThenParkSemaphore
+{
+public:
+    /**
+     * @brief Constructor
+     *
+     * @param desired Initial count
+     */
+    explicit SpinThenParkSemaphore(std::ptrdiff_t desired) : count_(desired)
+    {
+        assert(desired >= 0);
+    }
+
+    ~SpinThenParkSemaphore() = default;
+
+    // Non-copyable, non-movable
+    SpinThenParkSemaphore(const SpinThenParkSemaphore& rhs) = delete;
+    SpinThenParkSemaphore(SpinThenParkSemaphore&& rhs) = delete;
+    SpinThenParkSemaphore& operator=(const SpinThenParkSemaphore& rhs) = delete;
+    SpinThenParkSemaphore& operator=(SpinThenParkSemaphore&& rhs) = delete;
+
+    /**
+     * @brief Increment count, wake a parked waiter
+     */
+    void release()
+    {
+        if (count_.fetch_add(1, std::memory_order_release) < 0)
+        {
+            park_.release();
+        }
+    }
+
+    /**
+     * @brief Decrement count, spin and then park while it is zero
+     */
+    void acquire()
+    {
+        if (Spin() || (count_.fetch_sub(1, std::memory_order_acquire) > 0))
+        {
+            return;
+        }
+        park_.acquire();
+    }
+
+    /**
+     * @brief Decrement count if it is not zero
+     *
+     * @return true Count was decremented
+     */
+    bool try_acquire()
+    {
+        auto count = count_.load(std::memory_order_relaxed);
+        while (count > 0)
+        {
+            if (count_.compare_exchange_weak(count, count - 1, std::memory_order_acquire, std::memory_order_relaxed))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Decrement count, spin and then park while it is zero until deadline has passed
+     *
+     * @param deadline
+     * @return true Count was decremented, false: timeout
+     */
+    template <typename Clock, typename Duration>
+    bool try_acquire_until(const std::chrono::time_point<Clock, Duration>& deadline)
+    {
+        if (Spin() || (count_.fetch_sub(1, std::memory_order_acquire) > 0) || park_.try_acquire_until(deadline))
+        {
+            return true;
+        }
+
+        // Timeout: stop being a waiter - unless a release() has already handed its count over
+        auto count = count_.load(std::memory_order_relaxed);
+        while (count < 0)
+        {
+            if (count_.compare_exchange_weak(count, count + 1, std::memory_order_relaxed))
+            {
+                return false;
+            }
+        }
+        park_.acquire();
+        return true;
+    }
+
+private:
+    alignas(kCacheLineSize) std::atomic<std::ptrdiff_t> count_;
+    std::counting_semaphore<> park_{0};
+
+    bool Spin()
+    {
+        for (size_t i = 0; i < SpinCount; i++)
+        {
+            if (try_acquire())
+            {
+                return true;
+            }
+            CpuRelax();
+        }
+        return false;
+    }
+};
+
+/**
+ * @brief Wait strategy "blocking": every waiter sleeps in the kernel until it is woken
+ */
+using BlockingSemaphore = std::counting_semaphore<>;
+} // namespace cpp_event_framework
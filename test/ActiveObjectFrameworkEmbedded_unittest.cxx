@@ -10,10 +10,16 @@
 
 #include "../examples/activeobject_embedded/FsmImpl.hxx"
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <iostream>
+#include <semaphore>
+#include <span>
+#include <thread>
 #include <vector>
 
+#include <cpp_active_objects_embedded/ActiveObjectBase.hxx>
 #include <cpp_active_objects_embedded/EventQueue.hxx>
 #include <cpp_active_objects_embedded/SingleThreadActiveObjectDomain.hxx>
 #include <cpp_event_framework/Signal.hxx>
@@ -27,6 +33,94 @@ extern "C"
 }
 static bool malloc_called = false;
 
+namespace
+{
+class BatchEvent : public cpp_event_framework::SignalBase<BatchEvent, 0>
+{
+public:
+    explicit BatchEvent(uint32_t sequence) : sequence_(sequence)
+    {
+    }
+
+    const uint32_t sequence_;
+};
+class UrgentBatchEvent : public cpp_event_framework::NextSignal<UrgentBatchEvent, BatchEvent>
+{
+};
+
+// Sequence 0 blocks until gate_ is released, sequence 2 takes an UrgentBatchEvent at the front of the queue
+class BatchRecordingObject : public cpp_active_objects_embedded::ActiveObjectBase
+{
+public:
+    static constexpr uint32_t kUrgent = 100;
+
+    void Dispatch(const cpp_event_framework::Signal::SPtr& event) override
+    {
+        if (UrgentBatchEvent::Check(event))
+        {
+            order_.emplace_back(kUrgent);
+        }
+        else
+        {
+            const auto sequence = BatchEvent::FromSignal(event)->sequence_;
+            if (sequence == 0)
+            {
+                blocked_ = true;
+                gate_.acquire();
+            }
+            else if (sequence == 2)
+            {
+                TakeHighPrio(UrgentBatchEvent::MakeShared());
+            }
+            order_.emplace_back(sequence);
+        }
+        count_++;
+    }
+
+    size_t Dispatch(std::span<const cpp_event_framework::Signal::SPtr> events) override
+    {
+        batch_sizes_.emplace_back(events.size());
+        return ActiveObjectBase::Dispatch(events);
+    }
+
+    std::binary_semaphore gate_{0};
+    std::atomic<bool> blocked_ = false;
+    std::vector<uint32_t> order_;
+    std::vector<size_t> batch_sizes_;
+    std::atomic<size_t> count_ = 0;
+};
+
+void GroupedDispatchTest()
+{
+    cpp_active_objects_embedded::EventQueue<10> queue;
+    BatchRecordingObject object;
+    {
+        cpp_active_objects_embedded::SingleThreadActiveObjectDomain domain(&queue);
+        domain.RegisterObject(&object);
+
+        object.Take(BatchEvent::MakeShared(0));
+        while (!object.blocked_)
+        {
+            std::this_thread::sleep_for(1ms);
+        }
+        for (uint32_t e = 1; e <= 5; e++)
+        {
+            object.Take(BatchEvent::MakeShared(e));
+        }
+        object.gate_.release();
+        while (object.count_ != 7)
+        {
+            std::this_thread::sleep_for(1ms);
+        }
+    }
+
+    // Events 1..5 are passed in one call, it returns after event 2 took an event at the front.
+    // Urgent event is dispatched next, then the rest of the batch in one call.
+    assert((object.batch_sizes_ == std::vector<size_t>{5, 3}));
+    assert((object.order_ == std::vector<uint32_t>{0, 1, 2, BatchRecordingObject::kUrgent, 3, 4, 5}));
+}
+} // namespace
+
 // Uncomment this to check heap usage, but ASAN must be disabled in CMakeLists.txt for this to work
 // void* malloc(size_t size)
 // {
@@ -79,4 +173,6 @@ void ActiveObjectFrameworkEmbeddedMain()
     assert(active_object.CurrentState() == &example::activeobject_embedded::Fsm::kState1);
 
     assert(!malloc_called);
+
+    GroupedDispatchTest();
 }
@@ -8,16 +8,505 @@
  *
  */
 
+#include <atomic>
 #include <iostream>
 #include <memory>
+#include <semaphore>
+#include <span>
+#include <thread>
+#include <vector>
 
 #include "../examples/activeobject/FsmImpl.hxx"
 
+#include <cpp_active_objects/EventQueue.hxx>
+#include <cpp_active_objects/Hsm.hxx>
 #include <cpp_active_objects/SingleThreadActiveObjectDomain.hxx>
+#include <cpp_active_objects/ThreadPoolActiveObjectDomain.hxx>
 #include <cpp_event_framework/Pool.hxx>
 
 using namespace std::chrono_literals;
 
+namespace
+{
+class SequenceEvent : public cpp_event_framework::SignalBase<SequenceEvent, 0>
+{
+public:
+    explicit SequenceEvent(uint32_t sequence) : sequence_(sequence)
+    {
+    }
+
+    const uint32_t sequence_;
+};
+
+class SequenceCheckingActiveObject : public cpp_active_objects::ActiveObjectBase
+{
+public:
+    void Dispatch(const cpp_event_framework::Signal::SPtr& event) override
+    {
+        // Dispatch must never run concurrently with itself
+        assert(!in_dispatch_.exchange(true));
+
+        // Events must arrive in FIFO order
+        auto e = SequenceEvent::FromSignal(event);
+        assert(e->sequence_ == last_sequence_ + 1);
+        last_sequence_ = e->sequence_;
+
+        in_dispatch_ = false;
+        count_++;
+    }
+
+    uint32_t last_sequence_ = 0;
+    std::atomic<bool> in_dispatch_ = false;
+    std::atomic<uint32_t> count_ = 0;
+};
+
+class DeferGo : public cpp_event_framework::NextSignal<DeferGo, SequenceEvent>
+{
+};
+class DeferOther : public cpp_event_framework::NextSignal<DeferOther, DeferGo>
+{
+};
+
+class DeferringHsm;
+class DeferringFsm : public cpp_event_framework::Statemachine<DeferringHsm, const cpp_event_framework::Signal::SPtr&>
+{
+public:
+    static const State kWaiting;
+    static const State kReady;
+
+private:
+    // kWaiting defers DeferOther until DeferGo arrives
+    static Transition WaitingHandler(ImplPtr /*impl*/, Event event)
+    {
+        if (DeferGo::Check(event))
+        {
+            return TransitionTo(kReady);
+        }
+        return DeferOther::Check(event) ? DeferEvent() : UnhandledEvent();
+    }
+    static Transition ReadyHandler(ImplPtr /*impl*/, Event /*event*/)
+    {
+        return NoTransition();
+    }
+};
+
+class DeferringHsm : public cpp_active_objects::Hsm<DeferringFsm>
+{
+public:
+    DeferringHsm()
+    {
+        fsm_.Init(this, "DeferringFsm");
+        fsm_.Start(&DeferringFsm::kWaiting);
+    }
+
+    DeferringFsm::StatePtr CurrentState() const
+    {
+        return fsm_.CurrentState();
+    }
+
+    void ReadyEntry(DeferringFsm::Event /*event*/)
+    {
+        fsm_.RecallEvents();
+    }
+};
+
+const DeferringFsm::State DeferringFsm::kWaiting("Waiting", &DeferringFsm::WaitingHandler);
+const DeferringFsm::State DeferringFsm::kReady("Ready", &DeferringFsm::ReadyHandler, nullptr, nullptr,
+                                               &DeferringHsm::ReadyEntry, nullptr);
+
+void HsmBatchDispatchTest()
+{
+    auto queue = std::make_shared<cpp_active_objects::EventQueue<>>();
+    auto hsm = std::make_shared<DeferringHsm>();
+    hsm->SetQueue(queue);
+
+    const auto deferred = DeferOther::MakeShared();
+    const auto go = DeferGo::MakeShared();
+    const auto next = DeferOther::MakeShared();
+    const std::vector<cpp_event_framework::Signal::SPtr> batch = {deferred, go, next};
+
+    // DeferGo recalls the deferred event, batch processing stops there
+    assert(hsm->Dispatch(std::span<const cpp_event_framework::Signal::SPtr>(batch)) == 2);
+    assert(hsm->CurrentState() == &DeferringFsm::kReady);
+
+    // Recalled event at the front of the queue, rest of batch is left to the caller
+    assert(queue->Dequeue().event == deferred);
+    assert(!queue->DequeueUntil(std::chrono::steady_clock::now()).has_value());
+}
+
+template <typename Predicate>
+bool WaitFor(Predicate predicate)
+{
+    for (int i = 0; i < 1000; i++)
+    {
+        if (predicate())
+        {
+            return true;
+        }
+        std::this_thread::sleep_for(1ms);
+    }
+    return false;
+}
+
+class RecallTimeout : public cpp_event_framework::NextSignal<RecallTimeout, DeferOther, cpp_active_objects::TimeEvent>
+{
+};
+
+class TimedDeferringHsm;
+class TimedDeferringFsm
+    : public cpp_event_framework::Statemachine<TimedDeferringHsm, const cpp_event_framework::Signal::SPtr&>
+{
+public:
+    static const State kWaiting;
+    static const State kReady;
+
+private:
+    static Transition WaitingHandler(ImplPtr /*impl*/, Event event)
+    {
+        if (DeferGo::Check(event))
+        {
+            return TransitionTo(kReady);
+        }
+        return DeferOther::Check(event) ? DeferEvent() : UnhandledEvent();
+    }
+    static Transition ReadyHandler(ImplPtr impl, Event event);
+};
+
+class TimedDeferringHsm : public cpp_active_objects::Hsm<TimedDeferringFsm>
+{
+public:
+    TimedDeferringHsm()
+    {
+        fsm_.Init(this, "TimedDeferringFsm");
+        fsm_.Start(&TimedDeferringFsm::kWaiting);
+    }
+
+    // Recalls the deferred event and lets a time event expire before it is dispatched
+    void ReadyEntry(TimedDeferringFsm::Event /*event*/)
+    {
+        fsm_.RecallEvents();
+        ArmTimer(timeout_, 1ms);
+        std::this_thread::sleep_for(5ms);
+    }
+
+    void Record(cpp_event_framework::Signal::IdType id)
+    {
+        received_.emplace_back(id);
+        count_++;
+    }
+
+    RecallTimeout::SPtr timeout_ = RecallTimeout::MakeShared();
+    std::vector<cpp_event_framework::Signal::IdType> received_;
+    std::atomic<size_t> count_ = 0;
+};
+
+const TimedDeferringFsm::State TimedDeferringFsm::kWaiting("Waiting", &TimedDeferringFsm::WaitingHandler);
+const TimedDeferringFsm::State TimedDeferringFsm::kReady("Ready", &TimedDeferringFsm::ReadyHandler, nullptr, nullptr,
+                                                         &TimedDeferringHsm::ReadyEntry, nullptr);
+
+TimedDeferringFsm::Transition TimedDeferringFsm::ReadyHandler(ImplPtr impl, Event event)
+{
+    impl->Record(event->Id());
+    return NoTransition();
+}
+
+void HsmRecallBeforeTimeEventTest()
+{
+    auto domain = std::make_shared<cpp_active_objects::SingleThreadActiveObjectDomain<>>();
+    auto hsm = std::make_shared<TimedDeferringHsm>();
+    domain->RegisterObject(hsm);
+
+    // DeferGo is the last entry of its batch, the time event expires while it is dispatched:
+    // the recalled event is still dispatched first
+    hsm->Take(DeferOther::MakeShared());
+    hsm->Take(DeferGo::MakeShared());
+    assert(WaitFor([&hsm]() { return hsm->count_ == 2; }));
+    assert(hsm->received_.at(0) == DeferOther::kId);
+    assert(hsm->received_.at(1) == RecallTimeout::kId);
+}
+
+class GroupingHsm;
+class GroupingFsm : public cpp_event_framework::Statemachine<GroupingHsm, const cpp_event_framework::Signal::SPtr&>
+{
+public:
+    static const State kFirst;
+    static const State kSecond;
+    static const State kDone;
+
+private:
+    // kFirst and kSecond both defer DeferOther, DeferGo moves on
+    static Transition FirstHandler(ImplPtr /*impl*/, Event event)
+    {
+        if (DeferGo::Check(event))
+        {
+            return TransitionTo(kSecond);
+        }
+        return DeferOther::Check(event) ? DeferEvent() : UnhandledEvent();
+    }
+    static Transition SecondHandler(ImplPtr /*impl*/, Event event)
+    {
+        if (DeferGo::Check(event))
+        {
+            return TransitionTo(kDone);
+        }
+        return DeferOther::Check(event) ? DeferEvent() : UnhandledEvent();
+    }
+    static Transition DoneHandler(ImplPtr /*impl*/, Event /*event*/)
+    {
+        return NoTransition();
+    }
+};
+
+class GroupingHsm : public cpp_active_objects::Hsm<GroupingFsm>
+{
+public:
+    GroupingHsm()
+    {
+        fsm_.Init(this, "GroupingFsm");
+        fsm_.Start(&GroupingFsm::kFirst);
+    }
+
+    [[nodiscard]] size_t NumDeferred(GroupingFsm::StateRef state) const
+    {
+        return NumDeferredEvents(state);
+    }
+
+    void DoneEntry(GroupingFsm::Event /*event*/)
+    {
+        RecallEvents(GroupingFsm::kFirst);
+    }
+};
+
+const GroupingFsm::State GroupingFsm::kFirst("First", &GroupingFsm::FirstHandler);
+const GroupingFsm::State GroupingFsm::kSecond("Second", &GroupingFsm::SecondHandler);
+const GroupingFsm::State GroupingFsm::kDone("Done", &GroupingFsm::DoneHandler, nullptr, nullptr,
+                                            &GroupingHsm::DoneEntry, nullptr);
+
+void HsmDeferredGroupsTest()
+{
+    auto queue = std::make_shared<cpp_active_objects::EventQueue<std::counting_semaphore<>>>();
+    auto hsm = std::make_shared<GroupingHsm>();
+    hsm->SetQueue(queue);
+
+    const auto first1 = DeferOther::MakeShared();
+    const auto first2 = DeferOther::MakeShared();
+    const auto second = DeferOther::MakeShared();
+    hsm->Dispatch(first1);
+    hsm->Dispatch(first2);
+    hsm->Dispatch(DeferGo::MakeShared());
+    hsm->Dispatch(second);
+    assert(hsm->NumDeferred(GroupingFsm::kFirst) == 2);
+    assert(hsm->NumDeferred(GroupingFsm::kSecond) == 1);
+
+    // kDone only recalls the events deferred by kFirst, in deferral order
+    hsm->Dispatch(DeferGo::MakeShared());
+    assert(hsm->NumDeferred(GroupingFsm::kFirst) == 0);
+    assert(hsm->NumDeferred(GroupingFsm::kSecond) == 1);
+    assert(queue->Dequeue().event == first1);
+    assert(queue->Dequeue().event == first2);
+}
+
+void ObjectHandleTest()
+{
+    constexpr uint32_t kEvents = 100;
+
+    auto domain = std::make_shared<cpp_active_objects::SingleThreadActiveObjectDomain<>>(
+        std::make_shared<cpp_active_objects::EventQueue<std::counting_semaphore<>>>());
+    auto first = std::make_shared<SequenceCheckingActiveObject>();
+    auto second = std::make_shared<SequenceCheckingActiveObject>();
+
+    const auto first_handle = domain->RegisterObjectWithHandle(first);
+    const auto second_handle = domain->RegisterObjectWithHandle(second);
+    assert(first_handle.IsValid() && second_handle.IsValid());
+    assert(first_handle != second_handle);
+    assert(first->Handle() == first_handle);
+
+    // Domain holds one reference, taking events adds none
+    for (uint32_t e = 1; e <= kEvents; e++)
+    {
+        first->Take(SequenceEvent::MakeShared(e));
+        assert(first.use_count() == 2);
+    }
+    assert(WaitFor([&first]() { return first->count_ == kEvents; }));
+
+    // Events taken after deregistration are dropped, second object synchronizes with domain thread
+    domain->DeregisterObject(first_handle);
+    first->Take(SequenceEvent::MakeShared(kEvents + 1));
+    second->Take(SequenceEvent::MakeShared(1));
+    assert(WaitFor([&second]() { return second->count_ == 1; }));
+    assert(first->count_ == kEvents);
+    assert(first.use_count() == 1);
+
+    // Slot is reused with a new generation, stale entries do not reach the new object
+    auto third = std::make_shared<SequenceCheckingActiveObject>();
+    const auto third_handle = domain->RegisterObjectWithHandle(third);
+    assert(third_handle.index == first_handle.index);
+    assert(third_handle.generation != first_handle.generation);
+
+    first->Take(SequenceEvent::MakeShared(kEvents + 2));
+    third->Take(SequenceEvent::MakeShared(1));
+    second->Take(SequenceEvent::MakeShared(2));
+    assert(WaitFor([&second]() { return second->count_ == 2; }));
+    assert(third->count_ == 1);
+    assert(first->count_ == kEvents);
+}
+
+class UrgentEvent : public cpp_event_framework::NextSignal<UrgentEvent, RecallTimeout>
+{
+};
+
+class GatedHsm;
+class GatedFsm : public cpp_event_framework::Statemachine<GatedHsm, const cpp_event_framework::Signal::SPtr&>
+{
+public:
+    static const State kActive;
+
+private:
+    static Transition ActiveHandler(ImplPtr impl, Event event);
+};
+
+// Sequence 0 blocks until gate_ is released, sequence 2 takes an UrgentEvent at the front of the queue
+class GatedHsm : public cpp_active_objects::Hsm<GatedFsm>
+{
+public:
+    static constexpr uint32_t kUrgent = 100;
+
+    GatedHsm()
+    {
+        fsm_.Init(this, "GatedFsm");
+        fsm_.Start(&GatedFsm::kActive);
+    }
+
+    using Hsm::Dispatch;
+
+    size_t Dispatch(std::span<const cpp_event_framework::Signal::SPtr> events) override
+    {
+        batch_sizes_.emplace_back(events.size());
+        return Hsm::Dispatch(events);
+    }
+
+    void Record(GatedFsm::Event event)
+    {
+        if (UrgentEvent::Check(event))
+        {
+            order_.emplace_back(kUrgent);
+        }
+        else
+        {
+            const auto sequence = SequenceEvent::FromSignal(event)->sequence_;
+            if (sequence == 0)
+            {
+                blocked_ = true;
+                gate_.acquire();
+            }
+            else if (sequence == 2)
+            {
+                TakeHighPrio(UrgentEvent::MakeShared());
+            }
+            order_.emplace_back(sequence);
+        }
+        count_++;
+    }
+
+    std::binary_semaphore gate_{0};
+    std::atomic<bool> blocked_ = false;
+    std::vector<uint32_t> order_;
+    std::vector<size_t> batch_sizes_;
+    std::atomic<size_t> count_ = 0;
+};
+
+const GatedFsm::State GatedFsm::kActive("Active", &GatedFsm::ActiveHandler);
+
+GatedFsm::Transition GatedFsm::ActiveHandler(ImplPtr impl, Event event)
+{
+    impl->Record(event);
+    return NoTransition();
+}
+
+void ThreadPoolHighPrioInBatchTest()
+{
+    auto hsm = std::make_shared<GatedHsm>();
+    {
+        auto domain = std::make_shared<cpp_active_objects::ThreadPoolActiveObjectDomain<>>(2);
+        domain->RegisterObject(hsm);
+
+        // Events 1..5 queue up while event 0 blocks, they are dispatched as one batch
+        for (uint32_t e = 0; e <= 5; e++)
+        {
+            hsm->Take(SequenceEvent::MakeShared(e));
+        }
+        hsm->gate_.release();
+        assert(WaitFor([&hsm]() { return hsm->count_ == 7; }));
+    }
+
+    // Event taken at the front by event 2 goes before the rest of the batch
+    assert((hsm->order_ == std::vector<uint32_t>{0, 1, 2, GatedHsm::kUrgent, 3, 4, 5}));
+}
+
+void SingleThreadGroupedDispatchTest()
+{
+    auto hsm = std::make_shared<GatedHsm>();
+    {
+        auto domain = std::make_shared<cpp_active_objects::SingleThreadActiveObjectDomain<>>();
+        domain->RegisterObject(hsm);
+
+        hsm->Take(SequenceEvent::MakeShared(0));
+        assert(WaitFor([&hsm]() { return hsm->blocked_.load(); }));
+        for (uint32_t e = 1; e <= 5; e++)
+        {
+            hsm->Take(SequenceEvent::MakeShared(e));
+        }
+        hsm->gate_.release();
+        assert(WaitFor([&hsm]() { return hsm->count_ == 7; }));
+    }
+
+    // Events 1..5 are passed in one call, it returns after event 2 took an event at the front.
+    // Urgent event is dispatched next, then the rest of the batch in one call.
+    assert((hsm->batch_sizes_ == std::vector<size_t>{5, 3}));
+    assert((hsm->order_ == std::vector<uint32_t>{0, 1, 2, GatedHsm::kUrgent, 3, 4, 5}));
+}
+
+void ThreadPoolActiveObjectDomainTest()
+{
+    constexpr uint32_t kObjects = 16;
+    constexpr uint32_t kEvents = 500;
+
+    std::vector<std::shared_ptr<SequenceCheckingActiveObject>> objects;
+    {
+        auto domain = std::make_shared<cpp_active_objects::ThreadPoolActiveObjectDomain<>>(4);
+        assert(domain->NumThreads() == 4);
+
+        for (uint32_t i = 0; i < kObjects; i++)
+        {
+            objects.emplace_back(std::make_shared<SequenceCheckingActiveObject>());
+            domain->RegisterObject(objects.back());
+        }
+
+        for (uint32_t e = 1; e <= kEvents; e++)
+        {
+            for (const auto& object : objects)
+            {
+                object->Take(SequenceEvent::MakeShared(e));
+            }
+        }
+
+        // Statemachine objects work unchanged
+        auto active_object = std::make_shared<example::activeobject::FsmImpl>();
+        domain->RegisterObject(active_object);
+        active_object->Take(example::activeobject::Go2::MakeShared());
+        std::this_thread::sleep_for(100ms);
+        assert(active_object->CurrentState() == &example::activeobject::Fsm::kState2);
+
+        // Domain destructor drains all mailboxes
+    }
+
+    for (const auto& object : objects)
+    {
+        assert(object->count_ == kEvents);
+    }
+}
+} // namespace
+
 void ActiveObjectFrameworkMain()
 {
     auto pool = std::make_shared<cpp_event_framework::Pool<>>(
@@ -42,4 +531,12 @@ void ActiveObjectFrameworkMain()
     active_object->Take(example::activeobject::Go1::MakeShared());
     std::this_thread::sleep_for(500ms);
     assert(active_object->CurrentState() == &example::activeobject::Fsm::kState1);
+
+    HsmBatchDispatchTest();
+    HsmDeferredGroupsTest();
+    HsmRecallBeforeTimeEventTest();
+    ObjectHandleTest();
+    ThreadPoolActiveObjectDomainTest();
+    ThreadPoolHighPrioInBatchTest();
+    SingleThreadGroupedDispatchTest();
 }
@@ -0,0 +1,1086 @@
+/**
+ * @file EventQueues_unittest.cxx
+ * @author Dirk Ziegelmeier (dirk@ziegelmeier.net)
+ * @brief
+ * @date 16-10-2026
+ *
+ * @copyright SPDX-License-Identifier: Apache-2.0
+ *
+ */
+
+#include <array>
+#include <cassert>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <semaphore>
+#include <thread>
+#include <vector>
+
+#include <cpp_active_objects/ActiveObjectBase.hxx>
+#include <cpp_active_objects/EventQueue.hxx>
+#include <cpp_active_objects/IntrusiveEventQueue.hxx>
+#include <cpp_active_objects/LockFreeEventQueue.hxx>
+#include <cpp_active_objects/PriorityEventQueue.hxx>
+#include <cpp_active_objects/SingleThreadActiveObjectDomain.hxx>
+#include <cpp_active_objects/SpscEventQueue.hxx>
+#include <cpp_active_objects/ThreadPoolActiveObjectDomain.hxx>
+#include <cpp_active_objects_embedded/ActiveObjectBase.hxx>
+#include <cpp_active_objects_embedded/EventQueue.hxx>
+#include <cpp_active_objects_embedded/IntrusiveEventQueue.hxx>
+#include <cpp_active_objects_embedded/PriorityEventQueue.hxx>
+#include <cpp_active_objects_embedded/SingleThreadActiveObjectDomain.hxx>
+#include <cpp_active_objects_embedded/SpscEventQueue.hxx>
+#include <cpp_event_framework/Pool.hxx>
+#include <cpp_event_framework/Signal.hxx>
+#include <cpp_event_framework/WaitStrategy.hxx>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+class SequenceEvent : public cpp_event_framework::SignalBase<SequenceEvent, 0>
+{
+public:
+    SequenceEvent(uint32_t producer, uint32_t sequence) : producer_(producer), sequence_(sequence)
+    {
+    }
+
+    const uint32_t producer_;
+    const uint32_t sequence_;
+};
+
+class CountingActiveObject : public cpp_active_objects::ActiveObjectBase
+{
+public:
+    void Dispatch(const cpp_event_framework::Signal::SPtr& event) override
+    {
+        auto e = SequenceEvent::FromSignal(event);
+        if (e->producer_ < last_sequence_.size())
+        {
+            // FIFO per producer
+            assert(e->sequence_ == last_sequence_.at(e->producer_) + 1);
+            last_sequence_.at(e->producer_) = e->sequence_;
+        }
+        count_++;
+    }
+
+    std::vector<uint32_t> last_sequence_;
+    std::atomic<size_t> count_ = 0;
+};
+
+// Sequence 1 takes sequence 2 with high priority, it must be dispatched before sequence 3
+class HighPrioActiveObject : public cpp_active_objects::ActiveObjectBase
+{
+public:
+    void Dispatch(const cpp_event_framework::Signal::SPtr& event) override
+    {
+        auto e = SequenceEvent::FromSignal(event);
+        assert(e->sequence_ == last_sequence_ + 1);
+        last_sequence_ = e->sequence_;
+        if (e->sequence_ == 1)
+        {
+            TakeHighPrio(SequenceEvent::MakeShared(0, 2));
+        }
+        count_++;
+    }
+
+    uint32_t last_sequence_ = 0;
+    std::atomic<size_t> count_ = 0;
+};
+
+class CountingEmbeddedActiveObject : public cpp_active_objects_embedded::ActiveObjectBase
+{
+public:
+    void Dispatch(const cpp_event_framework::Signal::SPtr& event) override
+    {
+        auto e = SequenceEvent::FromSignal(event);
+        assert(e->sequence_ == last_sequence_ + 1);
+        last_sequence_ = e->sequence_;
+        count_++;
+    }
+
+    uint32_t last_sequence_ = 0;
+    std::atomic<size_t> count_ = 0;
+};
+
+class LinkedEvent : public cpp_event_framework::SignalBase<LinkedEvent, 1, cpp_active_objects::LinkableSignal>
+{
+public:
+    explicit LinkedEvent(uint32_t sequence) : sequence_(sequence)
+    {
+    }
+
+    const uint32_t sequence_;
+};
+
+class EmbeddedLinkedEvent
+    : public cpp_event_framework::SignalBase<EmbeddedLinkedEvent, 2, cpp_active_objects_embedded::LinkableSignal>
+{
+public:
+    explicit EmbeddedLinkedEvent(uint32_t sequence) : sequence_(sequence)
+    {
+    }
+
+    const uint32_t sequence_;
+};
+
+class CountingEmbeddedLinkedObject : public cpp_active_objects_embedded::ActiveObjectBase
+{
+public:
+    void Dispatch(const cpp_event_framework::Signal::SPtr& event) override
+    {
+        auto e = EmbeddedLinkedEvent::FromSignal(event);
+        assert(e->sequence_ == last_sequence_ + 1);
+        last_sequence_ = e->sequence_;
+        count_++;
+    }
+
+    uint32_t last_sequence_ = 0;
+    std::atomic<size_t> count_ = 0;
+};
+
+// Counts failed assertions instead of aborting
+class CountingAssertionProvider
+{
+public:
+    static void Assert(bool condition)
+    {
+        if (!condition)
+        {
+            failures++;
+        }
+    }
+
+    static inline std::atomic<size_t> failures = 0;
+};
+
+class PrioritizedEvent : public cpp_event_framework::SignalBase<PrioritizedEvent, 3>
+{
+public:
+    PrioritizedEvent(PriorityType priority, uint32_t sequence) : priority_(priority), sequence_(sequence)
+    {
+    }
+
+    [[nodiscard]] PriorityType Priority() const override
+    {
+        return priority_;
+    }
+
+    const PriorityType priority_;
+    const uint32_t sequence_;
+};
+
+// Sequence 0 blocks the domain thread until gate_ is released, the other events queue up meanwhile
+class PriorityRecordingObject : public cpp_active_objects::ActiveObjectBase
+{
+public:
+    void Dispatch(const cpp_event_framework::Signal::SPtr& event) override
+    {
+        auto e = PrioritizedEvent::FromSignal(event);
+        if (e->sequence_ == 0)
+        {
+            gate_.acquire();
+        }
+        order_.emplace_back(e->sequence_);
+        count_++;
+    }
+
+    std::binary_semaphore gate_{0};
+    std::vector<uint32_t> order_;
+    std::atomic<size_t> count_ = 0;
+};
+
+class CountingResource : public std::pmr::memory_resource
+{
+public:
+    size_t allocations_ = 0;
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override
+    {
+        allocations_++;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* ptr, size_t bytes, size_t alignment) override
+    {
+        std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+    }
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+};
+
+class IntrusiveQueueAllocator : public cpp_event_framework::CustomAllocator<IntrusiveQueueAllocator>
+{
+};
+
+class IntrusiveSequenceEvent
+    : public cpp_event_framework::SignalBase<IntrusiveSequenceEvent, 4, cpp_event_framework::RefCountedSignal<>,
+                                             IntrusiveQueueAllocator>
+{
+public:
+    explicit IntrusiveSequenceEvent(uint32_t sequence) : sequence_(sequence)
+    {
+    }
+
+    const uint32_t sequence_;
+};
+
+constexpr size_t kIntrusivePoolElementSize =
+    cpp_event_framework::SignalPoolElementSizeCalculator<IntrusiveSequenceEvent>::kHeapSize;
+constexpr size_t kIntrusivePoolSize = 4;
+
+// Records sequence numbers of std::shared_ptr and intrusive events in dispatch order
+template <typename Base>
+class MixedEventObject : public Base
+{
+public:
+    void Dispatch(const cpp_event_framework::Signal::SPtr& event) override
+    {
+        order_.push_back(SequenceEvent::FromSignal(event)->sequence_);
+        count_++;
+    }
+
+    void Dispatch(const cpp_event_framework::RefCountedSignal<>::IPtr& event) override
+    {
+        order_.push_back(IntrusiveSequenceEvent::FromSignal(event)->sequence_);
+        count_++;
+    }
+
+    std::vector<uint32_t> order_;
+    std::atomic<size_t> count_ = 0;
+};
+
+// Takes intrusive events, but only implements Dispatch(const Signal::SPtr&)
+template <typename Base>
+class SharedPtrOnlyObject : public Base
+{
+public:
+    void Dispatch(const cpp_event_framework::Signal::SPtr& event) override
+    {
+        if (event->Id() == IntrusiveSequenceEvent::kId)
+        {
+            order_.push_back(IntrusiveSequenceEvent::FromSignal(event)->sequence_);
+        }
+        else
+        {
+            order_.push_back(SequenceEvent::FromSignal(event)->sequence_);
+        }
+        count_++;
+    }
+
+    std::vector<uint32_t> order_;
+    std::atomic<size_t> count_ = 0;
+};
+
+// Queue and object implementing only the original pure virtual members, all others use the interface defaults
+class MinimalEventQueue : public cpp_active_objects::IEventQueue
+{
+public:
+    void EnqueueBack(std::shared_ptr<cpp_active_objects::IActiveObject> target,
+                     cpp_event_framework::Signal::SPtr event) override
+    {
+        std::scoped_lock lock(mutex_);
+        entries_.emplace_back(std::move(target), std::move(event));
+        available_.notify_one();
+    }
+
+    void EnqueueFront(std::shared_ptr<cpp_active_objects::IActiveObject> target,
+                      cpp_event_framework::Signal::SPtr event) override
+    {
+        std::scoped_lock lock(mutex_);
+        entries_.emplace_front(std::move(target), std::move(event));
+        available_.notify_one();
+    }
+
+    QueueEntry Dequeue() override
+    {
+        std::unique_lock lock(mutex_);
+        available_.wait(lock, [this]() { return !entries_.empty(); });
+        auto entry = std::move(entries_.front());
+        entries_.pop_front();
+        return entry;
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable available_;
+    std::deque<QueueEntry> entries_;
+};
+
+class MinimalActiveObject : public cpp_active_objects::IActiveObject
+{
+public:
+    void SetQueue(const std::shared_ptr<cpp_active_objects::IEventSink>& queue) override
+    {
+        queue_ = queue;
+    }
+
+    void Take(const cpp_event_framework::Signal::SPtr& event) override
+    {
+        queue_->EnqueueBack(std::static_pointer_cast<IActiveObject>(shared_from_this()), event);
+    }
+
+    void TakeHighPrio(const cpp_event_framework::Signal::SPtr& event) override
+    {
+        queue_->EnqueueFront(std::static_pointer_cast<IActiveObject>(shared_from_this()), event);
+    }
+
+    void Dispatch(const cpp_event_framework::Signal::SPtr& event) override
+    {
+        if (event->Id() == IntrusiveSequenceEvent::kId)
+        {
+            order_.push_back(IntrusiveSequenceEvent::FromSignal(event)->sequence_);
+        }
+        else
+        {
+            order_.push_back(SequenceEvent::FromSignal(event)->sequence_);
+        }
+        count_++;
+    }
+
+    std::vector<uint32_t> order_;
+    std::atomic<size_t> count_ = 0;
+
+private:
+    std::shared_ptr<cpp_active_objects::IEventSink> queue_;
+};
+
+struct EventQueuesFixture
+{
+    static void LockFreeEventQueueOrdering()
+    {
+        auto queue = std::make_shared<cpp_active_objects::LockFreeEventQueue<>>();
+        auto target = std::make_shared<CountingActiveObject>();
+
+        queue->EnqueueBack(target, SequenceEvent::MakeShared(100, 1));
+        queue->EnqueueBack(target, SequenceEvent::MakeShared(100, 2));
+        queue->EnqueueFront(target, SequenceEvent::MakeShared(100, 3));
+        queue->EnqueueFront(target, SequenceEvent::MakeShared(100, 4));
+
+        assert(SequenceEvent::FromSignal(queue->Dequeue().event)->sequence_ == 4);
+        queue->EnqueueFront(target, SequenceEvent::MakeShared(100, 5));
+        assert(SequenceEvent::FromSignal(queue->Dequeue().event)->sequence_ == 5);
+        assert(SequenceEvent::FromSignal(queue->Dequeue().event)->sequence_ == 3);
+        assert(SequenceEvent::FromSignal(queue->Dequeue().event)->sequence_ == 1);
+        assert(SequenceEvent::FromSignal(queue->Dequeue().event)->sequence_ == 2);
+
+        // Entries left in queue are released by destructor
+        queue->EnqueueBack(target, SequenceEvent::MakeShared(100, 6));
+        queue->EnqueueFront(target, SequenceEvent::MakeShared(100, 7));
+    }
+
+    template <typename Queue>
+    static void SpliceFrontOrdering(Queue& queue)
+    {
+        auto target = std::make_shared<CountingActiveObject>();
+
+        queue.EnqueueBack(target, SequenceEvent::MakeShared(100, 1));
+        queue.EnqueueFront(target, SequenceEvent::MakeShared(100, 2));
+
+        cpp_active_objects::IEventQueue::EntryList entries;
+        entries.emplace_back(target, SequenceEvent::MakeShared(100, 3));
+        entries.emplace_back(target, SequenceEvent::MakeShared(100, 4));
+        queue.SpliceFront(entries);
+        assert(entries.empty());
+
+        assert(SequenceEvent::FromSignal(queue.Dequeue().event)->sequence_ == 3);
+        assert(SequenceEvent::FromSignal(queue.Dequeue().event)->sequence_ == 4);
+        assert(SequenceEvent::FromSignal(queue.Dequeue().event)->sequence_ == 2);
+        assert(SequenceEvent::FromSignal(queue.Dequeue().event)->sequence_ == 1);
+    }
+
+    static void SpliceFront()
+    {
+        cpp_active_objects::EventQueue<std::counting_semaphore<>> queue;
+        SpliceFrontOrdering(queue);
+        cpp_active_objects::LockFreeEventQueue<> lock_free_queue;
+        SpliceFrontOrdering(lock_free_queue);
+        cpp_active_objects::SpscEventQueue<4> spsc_queue;
+        SpliceFrontOrdering(spsc_queue);
+    }
+
+    static void EmbeddedEnqueueFrontRange()
+    {
+        cpp_active_objects_embedded::EventQueue<4, std::counting_semaphore<>> queue;
+        CountingEmbeddedActiveObject target;
+
+        queue.EnqueueBack(&target, SequenceEvent::MakeShared(0, 1));
+        const std::vector<cpp_event_framework::Signal::SPtr> events = {SequenceEvent::MakeShared(0, 2),
+                                                                       SequenceEvent::MakeShared(0, 3)};
+        queue.EnqueueFrontRange(&target, events);
+
+        assert(SequenceEvent::FromSignal(queue.Dequeue().event)->sequence_ == 2);
+        assert(SequenceEvent::FromSignal(queue.Dequeue().event)->sequence_ == 3);
+        assert(SequenceEvent::FromSignal(queue.Dequeue().event)->sequence_ == 1);
+    }
+
+    static void EventQueueBatch()
+    {
+        cpp_active_objects::EventQueue<std::counting_semaphore<>> queue;
+        auto target = std::make_shared<CountingActiveObject>();
+        std::array<cpp_active_objects::IEventQueue::QueueEntry, 4> batch;
+
+        for (uint32_t i = 1; i <= 5; i++)
+        {
+            queue.EnqueueBack(target, SequenceEvent::MakeShared(100, i));
+        }
+        queue.EnqueueFront(target, SequenceEvent::MakeShared(100, 0));
+
+        const auto no_timeout = std::chrono::steady_clock::time_point::max();
+        assert(queue.DequeueBatch(batch, no_timeout) == batch.size());
+        for (uint32_t i = 0; i < batch.size(); i++)
+        {
+            assert(SequenceEvent::FromSignal(batch.at(i).event)->sequence_ == i);
+        }
+        assert(!queue.TryDequeueFront().has_value());
+
+        // Entries enqueued at the front while the batch is dispatched, newest first
+        queue.EnqueueFront(target, SequenceEvent::MakeShared(100, 10));
+        queue.EnqueueFront(target, SequenceEvent::MakeShared(100, 11));
+        assert(SequenceEvent::FromSignal(queue.TryDequeueFront()->event)->sequence_ == 11);
+        assert(SequenceEvent::FromSignal(queue.TryDequeueFront()->event)->sequence_ == 10);
+        assert(!queue.TryDequeueFront().has_value());
+
+        assert(queue.DequeueBatch(batch, no_timeout) == 2);
+        assert(SequenceEvent::FromSignal(batch.at(0).event)->sequence_ == 4);
+        assert(SequenceEvent::FromSignal(batch.at(1).event)->sequence_ == 5);
+
+        // All semaphore counts consumed
+        assert(queue.DequeueBatch(batch, std::chrono::steady_clock::now() + 10ms) == 0);
+        assert(!queue.DequeueUntil(std::chrono::steady_clock::now() + 10ms).has_value());
+    }
+
+    static void EmbeddedEventQueueBatch()
+    {
+        cpp_active_objects_embedded::EventQueue<8, std::counting_semaphore<>> queue;
+        CountingEmbeddedActiveObject target;
+        std::array<cpp_active_objects_embedded::IEventQueue::QueueEntry, 8> batch;
+
+        queue.EnqueueBack(&target, SequenceEvent::MakeShared(0, 1));
+        queue.EnqueueBack(&target, SequenceEvent::MakeShared(0, 2));
+        assert(queue.DequeueBatch(batch, std::chrono::steady_clock::time_point::max()) == 2);
+
+        const std::vector<cpp_event_framework::Signal::SPtr> events = {SequenceEvent::MakeShared(0, 3),
+                                                                       SequenceEvent::MakeShared(0, 4)};
+        queue.EnqueueFrontRange(&target, events);
+        assert(SequenceEvent::FromSignal(queue.TryDequeueFront()->event)->sequence_ == 3);
+        assert(SequenceEvent::FromSignal(queue.Dequeue().event)->sequence_ == 4);
+        assert(!queue.TryDequeueFront().has_value());
+        assert(!queue.DequeueUntil(std::chrono::steady_clock::now() + 10ms).has_value());
+    }
+
+    static void HighPrioDuringBatch()
+    {
+        auto target = std::make_shared<HighPrioActiveObject>();
+        {
+            auto domain = std::make_shared<cpp_active_objects::SingleThreadActiveObjectDomain<>>(
+                std::make_shared<cpp_active_objects::EventQueue<std::counting_semaphore<>>>());
+            domain->RegisterObject(target);
+
+            // Most likely dequeued as one batch
+            for (uint32_t i : {1U, 3U, 4U, 5U})
+            {
+                target->Take(SequenceEvent::MakeShared(0, i));
+            }
+            while (target->count_ != 5)
+            {
+                std::this_thread::yield();
+            }
+        }
+        assert(target->last_sequence_ == 5);
+    }
+
+    static void IntrusiveEventQueueOrdering()
+    {
+        CountingResource fallback;
+        cpp_active_objects::IntrusiveEventQueue<> queue(&fallback);
+        auto target = std::make_shared<CountingActiveObject>();
+
+        const auto first = LinkedEvent::MakeShared(1);
+        const auto second = LinkedEvent::MakeShared(2);
+        queue.EnqueueBack(target, first);
+        queue.EnqueueBack(target, second);
+        queue.EnqueueFront(target, LinkedEvent::MakeShared(3));
+        assert(fallback.allocations_ == 0);
+
+        // Multicast: link of "first" is in use, second entry gets an allocated link
+        queue.EnqueueBack(target, first);
+        assert(fallback.allocations_ == 1);
+
+        // Non-linkable signals always need an allocated link
+        queue.EnqueueBack(target, SequenceEvent::MakeShared(100, 4));
+        assert(fallback.allocations_ == 2);
+
+        assert(LinkedEvent::FromSignal(queue.Dequeue().event)->sequence_ == 3);
+        assert(queue.Dequeue().event == first);
+        assert(queue.Dequeue().event == second);
+        assert(queue.Dequeue().event == first);
+        assert(SequenceEvent::FromSignal(queue.Dequeue().event)->sequence_ == 4);
+
+        // Queue does not hold references after dequeue, link can be reused
+        assert(first.use_count() == 1);
+        queue.EnqueueBack(target, first);
+        assert(fallback.allocations_ == 2);
+        assert(queue.Dequeue().event == first);
+
+        // Entries left in queue are released by destructor
+        queue.EnqueueBack(target, second);
+    }
+
+    static void IntrusiveEventQueueEmbeddedDomain()
+    {
+        constexpr uint32_t kEvents = 1000;
+
+        // No fallback resource: only linkable signals, one queue position each
+        cpp_active_objects_embedded::IntrusiveEventQueue<> queue;
+        CountingEmbeddedLinkedObject target;
+        {
+            cpp_active_objects_embedded::SingleThreadActiveObjectDomain domain(&queue);
+            domain.RegisterObject(&target);
+
+            for (uint32_t i = 1; i <= kEvents; i++)
+            {
+                target.Take(EmbeddedLinkedEvent::MakeShared(i));
+            }
+            while (target.count_ != kEvents)
+            {
+                std::this_thread::sleep_for(1ms);
+            }
+        }
+        assert(target.last_sequence_ == kEvents);
+    }
+
+    static void LockFreeEventQueueMultiProducer()
+    {
+        constexpr uint32_t kProducers = 4;
+        constexpr uint32_t kEventsPerProducer = 1000;
+
+        auto target = std::make_shared<CountingActiveObject>();
+        target->last_sequence_.resize(kProducers, 0);
+
+        {
+            auto domain = std::make_shared<cpp_active_objects::SingleThreadActiveObjectDomain<>>(
+                std::make_shared<cpp_active_objects::LockFreeEventQueue<>>());
+            domain->RegisterObject(target);
+
+            std::vector<std::jthread> producers;
+            for (uint32_t p = 0; p < kProducers; p++)
+            {
+                producers.emplace_back(
+                    [target, p]()
+                    {
+                        for (uint32_t i = 1; i <= kEventsPerProducer; i++)
+                        {
+                            target->Take(SequenceEvent::MakeShared(p, i));
+                        }
+                    });
+            }
+            producers.clear();
+
+            while (target->count_ != kProducers * kEventsPerProducer)
+            {
+                std::this_thread::sleep_for(1ms);
+            }
+        }
+
+        for (auto last : target->last_sequence_)
+        {
+            assert(last == kEventsPerProducer);
+        }
+    }
+
+    // Pauses let the consumer go idle (spinning or parked), timers use timed waits
+    template <typename SemaphoreType>
+    static void WaitStrategyDomain()
+    {
+        constexpr uint32_t kProducers = 2;
+        constexpr uint32_t kEventsPerProducer = 200;
+
+        auto target = std::make_shared<CountingActiveObject>();
+        target->last_sequence_.resize(kProducers, 0);
+
+        {
+            auto domain = std::make_shared<cpp_active_objects::SingleThreadActiveObjectDomain<>>(
+                std::make_shared<cpp_active_objects::EventQueue<SemaphoreType>>());
+            domain->RegisterObject(target);
+
+            std::vector<std::jthread> producers;
+            for (uint32_t p = 0; p < kProducers; p++)
+            {
+                producers.emplace_back(
+                    [target, p]()
+                    {
+                        for (uint32_t i = 1; i <= kEventsPerProducer; i++)
+                        {
+                            target->Take(SequenceEvent::MakeShared(p, i));
+                            if ((i % 50) == 0)
+                            {
+                                std::this_thread::sleep_for(2ms);
+                            }
+                        }
+                    });
+            }
+            producers.clear();
+
+            while (target->count_ != kProducers * kEventsPerProducer)
+            {
+                std::this_thread::sleep_for(1ms);
+            }
+        }
+
+        for (auto last : target->last_sequence_)
+        {
+            assert(last == kEventsPerProducer);
+        }
+    }
+
+    static void WaitStrategies()
+    {
+        cpp_event_framework::SpinThenParkSemaphore<16> park(0);
+        assert(!park.try_acquire());
+        assert(!park.try_acquire_until(std::chrono::steady_clock::now() + 5ms));
+        park.release();
+        assert(park.try_acquire_until(std::chrono::steady_clock::now() + 5ms));
+
+        // Parked waiter is woken by release()
+        std::jthread waiter([&park]() { park.acquire(); });
+        std::this_thread::sleep_for(20ms);
+        park.release();
+        waiter.join();
+        assert(!park.try_acquire());
+
+        cpp_event_framework::BusyPollSemaphore poll(1);
+        assert(poll.try_acquire());
+        assert(!poll.try_acquire_until(std::chrono::steady_clock::now() + 1ms));
+        poll.release();
+        poll.acquire();
+
+        WaitStrategyDomain<cpp_event_framework::BusyPollSemaphore>();
+        WaitStrategyDomain<cpp_event_framework::SpinThenParkSemaphore<>>();
+        WaitStrategyDomain<cpp_event_framework::BlockingSemaphore>();
+    }
+
+    static void SpscEventQueueOrdering()
+    {
+        using Queue = cpp_active_objects::SpscEventQueue<3, cpp_event_framework::EQueueFullPolicy::kDrop>;
+        auto queue = std::make_shared<Queue>();
+        auto target = std::make_shared<CountingActiveObject>();
+
+        queue->EnqueueBack(target, SequenceEvent::MakeShared(100, 1));
+        queue->EnqueueBack(target, SequenceEvent::MakeShared(100, 2));
+        queue->EnqueueBack(target, SequenceEvent::MakeShared(100, 3));
+        queue->EnqueueBack(target, SequenceEvent::MakeShared(100, 4));
+        assert(queue->Dropped() == 1);
+
+        assert(SequenceEvent::FromSignal(queue->Dequeue().event)->sequence_ == 1);
+        queue->EnqueueFront(target, SequenceEvent::MakeShared(100, 5));
+        queue->EnqueueFront(target, SequenceEvent::MakeShared(100, 6));
+        assert(SequenceEvent::FromSignal(queue->Dequeue().event)->sequence_ == 6);
+        assert(SequenceEvent::FromSignal(queue->Dequeue().event)->sequence_ == 5);
+        assert(SequenceEvent::FromSignal(queue->Dequeue().event)->sequence_ == 2);
+        queue->EnqueueBack(target, SequenceEvent::MakeShared(100, 7));
+        assert(SequenceEvent::FromSignal(queue->Dequeue().event)->sequence_ == 3);
+        assert(SequenceEvent::FromSignal(queue->Dequeue().event)->sequence_ == 7);
+
+        // Front entries are not bounded, spliced entries keep their order
+        constexpr uint32_t kSpliced = 40;
+        cpp_active_objects::IEventSink::EntryList entries;
+        for (uint32_t i = 0; i < kSpliced; i++)
+        {
+            entries.emplace_back(target, SequenceEvent::MakeShared(100, 10 + i));
+        }
+        queue->EnqueueBack(target, SequenceEvent::MakeShared(100, 8));
+        queue->SpliceFront(entries);
+        assert(entries.empty());
+        queue->EnqueueFront(target, SequenceEvent::MakeShared(100, 9));
+        assert(SequenceEvent::FromSignal(queue->Dequeue().event)->sequence_ == 9);
+        for (uint32_t i = 0; i < kSpliced; i++)
+        {
+            assert(SequenceEvent::FromSignal(queue->Dequeue().event)->sequence_ == 10 + i);
+        }
+        assert(SequenceEvent::FromSignal(queue->Dequeue().event)->sequence_ == 8);
+    }
+
+    static void EmbeddedSpscEventQueueFrontCapacity()
+    {
+        using Queue = cpp_active_objects_embedded::SpscEventQueue<4, cpp_event_framework::EQueueFullPolicy::kAssert, 3,
+                                                                  std::counting_semaphore<>, CountingAssertionProvider>;
+        Queue queue;
+        CountingEmbeddedActiveObject target;
+
+        // Range keeps its order, in front of older front entries
+        queue.EnqueueFront(&target, SequenceEvent::MakeShared(0, 3));
+        const std::vector<cpp_event_framework::Signal::SPtr> events = {SequenceEvent::MakeShared(0, 1),
+                                                                       SequenceEvent::MakeShared(0, 2)};
+        queue.EnqueueFrontRange(&target, events);
+        assert(CountingAssertionProvider::failures == 0);
+
+        // Full: asserts and drops instead of accessing out of range
+        queue.EnqueueFront(&target, SequenceEvent::MakeShared(0, 4));
+        assert(CountingAssertionProvider::failures == 1);
+        for (uint32_t sequence : {1U, 2U, 3U})
+        {
+            assert(SequenceEvent::FromSignal(queue.Dequeue().event)->sequence_ == sequence);
+        }
+
+        // Range that does not fit is dropped as a whole
+        queue.EnqueueFront(&target, SequenceEvent::MakeShared(0, 5));
+        queue.EnqueueFront(&target, SequenceEvent::MakeShared(0, 6));
+        queue.EnqueueFrontRange(&target, events);
+        assert(CountingAssertionProvider::failures == 2);
+        assert(SequenceEvent::FromSignal(queue.Dequeue().event)->sequence_ == 6);
+        assert(SequenceEvent::FromSignal(queue.Dequeue().event)->sequence_ == 5);
+        CountingAssertionProvider::failures = 0;
+    }
+
+    static void SpscEventQueueFrontFromForeignThread()
+    {
+        using Queue = cpp_active_objects::SpscEventQueue<4, cpp_event_framework::EQueueFullPolicy::kAssert,
+                                                         std::counting_semaphore<>, CountingAssertionProvider>;
+        Queue queue;
+        auto target = std::make_shared<CountingActiveObject>();
+
+        // Consumer not known yet: any thread may enqueue at the front
+        std::jthread([&queue, &target]() { queue.EnqueueFront(target, SequenceEvent::MakeShared(100, 1)); }).join();
+        assert(CountingAssertionProvider::failures == 0);
+        assert(SequenceEvent::FromSignal(queue.Dequeue().event)->sequence_ == 1);
+
+        // Consumer thread is fine, other threads assert
+        queue.EnqueueFront(target, SequenceEvent::MakeShared(100, 2));
+        assert(CountingAssertionProvider::failures == 0);
+        std::jthread([&queue, &target]() { queue.EnqueueFront(target, SequenceEvent::MakeShared(100, 3)); }).join();
+        assert(CountingAssertionProvider::failures == 1);
+        CountingAssertionProvider::failures = 0;
+    }
+
+    static uint32_t DequeuedSequence(cpp_active_objects::IEventQueue& queue)
+    {
+        return PrioritizedEvent::FromSignal(queue.Dequeue().event)->sequence_;
+    }
+
+    static void PriorityEventQueueOrdering()
+    {
+        cpp_active_objects::PriorityEventQueue<4> queue;
+        auto target = std::make_shared<CountingActiveObject>();
+
+        queue.EnqueueBack(target, PrioritizedEvent::MakeShared(0, 1));
+        queue.EnqueueBack(target, PrioritizedEvent::MakeShared(2, 2));
+        queue.EnqueueBack(target, PrioritizedEvent::MakeShared(0, 3));
+        queue.EnqueueBack(target, PrioritizedEvent::MakeShared(7, 4)); // clamped to level 3
+        queue.EnqueueBack(target, PrioritizedEvent::MakeShared(2, 5));
+        queue.EnqueueFront(target, PrioritizedEvent::MakeShared(0, 6));
+        queue.EnqueueFront(target, PrioritizedEvent::MakeShared(2, 7));
+
+        // Highest level first, FIFO within a level, EnqueueFront() only in front of its own level
+        for (uint32_t sequence : {4U, 7U, 2U, 5U, 6U, 1U, 3U})
+        {
+            assert(DequeuedSequence(queue) == sequence);
+        }
+
+        // Explicit priority overrides the signal's Priority()
+        queue.EnqueueBack(target, PrioritizedEvent::MakeShared(0, 8));
+        queue.EnqueueBack(cpp_active_objects::ObjectHandle{0, 0}, PrioritizedEvent::MakeShared(0, 9), 1);
+        auto entry = queue.Dequeue();
+        assert(PrioritizedEvent::FromSignal(entry.event)->sequence_ == 9);
+        assert(entry.target == nullptr);
+        assert((entry.handle == cpp_active_objects::ObjectHandle{0, 0}));
+        assert(DequeuedSequence(queue) == 8);
+
+        assert(!queue.DequeueUntil(std::chrono::steady_clock::now() + 1ms).has_value());
+
+        // Entries left in queue are released by destructor
+        queue.EnqueueBack(target, PrioritizedEvent::MakeShared(1, 10));
+    }
+
+    static void PriorityEventQueueDomain()
+    {
+        auto target = std::make_shared<PriorityRecordingObject>();
+        {
+            auto domain = std::make_shared<cpp_active_objects::SingleThreadActiveObjectDomain<>>(
+                std::make_shared<cpp_active_objects::PriorityEventQueue<3>>());
+            domain->RegisterObject(target);
+
+            target->Take(PrioritizedEvent::MakeShared(2, 0));
+            target->Take(PrioritizedEvent::MakeShared(0, 1));
+            target->Take(PrioritizedEvent::MakeShared(0, 2), 2);
+            target->Take(PrioritizedEvent::MakeShared(1, 3));
+            target->Take(PrioritizedEvent::MakeShared(0, 4), 2);
+            target->TakeHighPrio(PrioritizedEvent::MakeShared(0, 5));
+            target->gate_.release();
+
+            while (target->count_ != 6)
+            {
+                std::this_thread::sleep_for(1ms);
+            }
+        }
+        assert((target->order_ == std::vector<uint32_t>{0, 2, 4, 3, 5, 1}));
+    }
+
+    static void PriorityEventQueueDeregistration()
+    {
+        auto object = std::make_shared<PriorityRecordingObject>();
+        auto witness = std::make_shared<PriorityRecordingObject>();
+        {
+            auto domain = std::make_shared<cpp_active_objects::SingleThreadActiveObjectDomain<>>(
+                std::make_shared<cpp_active_objects::PriorityEventQueue<3>>());
+            const auto handle = domain->RegisterObjectWithHandle(object);
+            domain->RegisterObject(witness);
+
+            // Deregistration marker is in the highest level, a priority event taken afterwards cannot overtake it
+            object->Take(PrioritizedEvent::MakeShared(2, 0));
+            domain->DeregisterObject(handle);
+            object->Take(PrioritizedEvent::MakeShared(2, 1));
+            witness->Take(PrioritizedEvent::MakeShared(0, 1));
+            object->gate_.release();
+
+            while (witness->count_ != 1)
+            {
+                std::this_thread::sleep_for(1ms);
+            }
+        }
+        assert((object->order_ == std::vector<uint32_t>{0}));
+        assert(object.use_count() == 1);
+
+        // Stop requests overtake pending entries of lower levels too
+        cpp_active_objects::PriorityEventQueue<3> queue;
+        queue.EnqueueBack(witness, PrioritizedEvent::MakeShared(1, 2));
+        queue.EnqueueBack(nullptr, cpp_event_framework::Signal::SPtr());
+        auto entry = queue.Dequeue();
+        assert((entry.target == nullptr) && (entry.event == nullptr));
+        assert(PrioritizedEvent::FromSignal(queue.Dequeue().event)->sequence_ == 2);
+    }
+
+    static void EmbeddedPriorityEventQueueOrdering()
+    {
+        cpp_active_objects_embedded::PriorityEventQueue<8, 2> queue;
+        CountingEmbeddedActiveObject target;
+
+        queue.EnqueueBack(&target, PrioritizedEvent::MakeShared(0, 1));
+        queue.EnqueueBack(&target, PrioritizedEvent::MakeShared(1, 2));
+        queue.EnqueueBack(&target, PrioritizedEvent::MakeShared(0, 3), 1);
+        queue.EnqueueFront(&target, PrioritizedEvent::MakeShared(0, 4));
+
+        for (uint32_t sequence : {2U, 3U, 4U, 1U})
+        {
+            auto entry = queue.Dequeue();
+            assert(entry.target == &target);
+            assert(PrioritizedEvent::FromSignal(entry.event)->sequence_ == sequence);
+        }
+
+        // Stop request in the highest level
+        queue.EnqueueBack(&target, PrioritizedEvent::MakeShared(0, 5));
+        queue.EnqueueBack(nullptr, cpp_event_framework::Signal::SPtr());
+        assert(queue.Dequeue().target == nullptr);
+        assert(PrioritizedEvent::FromSignal(queue.Dequeue().event)->sequence_ == 5);
+    }
+
+    static void SpscEventQueueEmbeddedDomain()
+    {
+        constexpr uint32_t kEvents = 10000;
+
+        cpp_active_objects_embedded::SpscEventQueue<16, cpp_event_framework::EQueueFullPolicy::kSpin> queue;
+        CountingEmbeddedActiveObject target;
+        {
+            cpp_active_objects_embedded::SingleThreadActiveObjectDomain domain(&queue);
+            domain.RegisterObject(&target);
+
+            std::jthread producer(
+                [&target]()
+                {
+                    for (uint32_t i = 1; i <= kEvents; i++)
+                    {
+                        target.Take(SequenceEvent::MakeShared(0, i));
+                    }
+                });
+            producer.join();
+
+            while (target.count_ != kEvents)
+            {
+                std::this_thread::sleep_for(1ms);
+            }
+        }
+        assert(target.last_sequence_ == kEvents);
+    }
+
+    template <typename Object>
+    static void TakeMixedEvents(Object& object)
+    {
+        object.Take(IntrusiveSequenceEvent::MakeIntrusive(1U));
+        object.Take(SequenceEvent::MakeShared(0, 2));
+        object.Take(IntrusiveSequenceEvent::MakeIntrusive(3U));
+    }
+
+    template <typename Queue, typename... Args>
+    static void IntrusiveEventsInDomain(const cpp_event_framework::Pool<>& pool, Args... args)
+    {
+        auto target = std::make_shared<MixedEventObject<cpp_active_objects::ActiveObjectBase>>();
+        auto handle_target = std::make_shared<MixedEventObject<cpp_active_objects::ActiveObjectBase>>();
+        {
+            auto domain = std::make_shared<cpp_active_objects::SingleThreadActiveObjectDomain<>>(
+                std::make_shared<Queue>(args...));
+            domain->RegisterObject(target);
+            domain->RegisterObjectWithHandle(handle_target);
+
+            TakeMixedEvents(*target);
+            TakeMixedEvents(*handle_target);
+            while ((target->count_ != 3) || (handle_target->count_ != 3))
+            {
+                std::this_thread::sleep_for(1ms);
+            }
+        }
+        assert((target->order_ == std::vector<uint32_t>{1, 2, 3}));
+        assert((handle_target->order_ == std::vector<uint32_t>{1, 2, 3}));
+        assert(pool.FillLevel() == kIntrusivePoolSize);
+    }
+
+    static void IntrusiveEventsInThreadPool(const cpp_event_framework::Pool<>& pool)
+    {
+        auto target = std::make_shared<MixedEventObject<cpp_active_objects::ActiveObjectBase>>();
+        auto handle_target = std::make_shared<MixedEventObject<cpp_active_objects::ActiveObjectBase>>();
+        {
+            auto domain = std::make_shared<cpp_active_objects::ThreadPoolActiveObjectDomain<>>(2);
+            domain->RegisterObject(target);
+            // No registry: registered by reference
+            assert(!domain->RegisterObjectWithHandle(handle_target).IsValid());
+
+            TakeMixedEvents(*target);
+            TakeMixedEvents(*handle_target);
+            while ((target->count_ != 3) || (handle_target->count_ != 3))
+            {
+                std::this_thread::sleep_for(1ms);
+            }
+        }
+        assert((target->order_ == std::vector<uint32_t>{1, 2, 3}));
+        assert((handle_target->order_ == std::vector<uint32_t>{1, 2, 3}));
+        assert(pool.FillLevel() == kIntrusivePoolSize);
+    }
+
+    static void IntrusiveEventsToSharedPtrOnlyObject(const cpp_event_framework::Pool<>& pool)
+    {
+        auto target = std::make_shared<SharedPtrOnlyObject<cpp_active_objects::ActiveObjectBase>>();
+        {
+            auto domain = std::make_shared<cpp_active_objects::SingleThreadActiveObjectDomain<>>();
+            domain->RegisterObject(target);
+
+            TakeMixedEvents(*target);
+            while (target->count_ != 3)
+            {
+                std::this_thread::sleep_for(1ms);
+            }
+        }
+        assert((target->order_ == std::vector<uint32_t>{1, 2, 3}));
+        assert(pool.FillLevel() == kIntrusivePoolSize);
+
+        SharedPtrOnlyObject<cpp_active_objects_embedded::ActiveObjectBase> embedded_target;
+        {
+            cpp_active_objects_embedded::EventQueue<8> queue;
+            cpp_active_objects_embedded::SingleThreadActiveObjectDomain domain(&queue);
+            domain.RegisterObject(&embedded_target);
+
+            TakeMixedEvents(embedded_target);
+            while (embedded_target.count_ != 3)
+            {
+                std::this_thread::sleep_for(1ms);
+            }
+        }
+        assert((embedded_target.order_ == std::vector<uint32_t>{1, 2, 3}));
+        assert(pool.FillLevel() == kIntrusivePoolSize);
+    }
+
+    static void InterfaceDefaults(const cpp_event_framework::Pool<>& pool)
+    {
+        auto target = std::make_shared<MinimalActiveObject>();
+        {
+            auto domain = std::make_shared<cpp_active_objects::SingleThreadActiveObjectDomain<>>(
+                std::make_shared<MinimalEventQueue>());
+            // Queue does not support handles: registered by reference
+            assert(!domain->RegisterObjectWithHandle(target).IsValid());
+
+            cpp_active_objects::IEventTarget& event_target = *target;
+            TakeMixedEvents(event_target);
+            event_target.Take(SequenceEvent::MakeShared(0, 4), 1);
+            event_target.TakeHighPrio(IntrusiveSequenceEvent::MakeIntrusive(5U));
+            while (target->count_ != 5)
+            {
+                std::this_thread::sleep_for(1ms);
+            }
+        }
+        assert(target->order_.size() == 5);
+        assert(pool.FillLevel() == kIntrusivePoolSize);
+    }
+
+    template <typename Queue>
+    static void EmbeddedIntrusiveEventsInDomain(const cpp_event_framework::Pool<>& pool, Queue& queue)
+    {
+        MixedEventObject<cpp_active_objects_embedded::ActiveObjectBase> target;
+        {
+            cpp_active_objects_embedded::SingleThreadActiveObjectDomain domain(&queue);
+            domain.RegisterObject(&target);
+
+            TakeMixedEvents(target);
+            while (target.count_ != 3)
+            {
+                std::this_thread::sleep_for(1ms);
+            }
+        }
+        assert((target.order_ == std::vector<uint32_t>{1, 2, 3}));
+        assert(pool.FillLevel() == kIntrusivePoolSize);
+    }
+
+    static void IntrusiveEvents()
+    {
+        // Pool elements only hold the event - no std::shared_ptr control block anywhere
+        auto pool = cpp_event_framework::Pool<>::MakeShared(kIntrusivePoolElementSize, kIntrusivePoolSize,
+                                                            "IntrusiveQueuePool");
+        IntrusiveQueueAllocator::SetAllocator(pool);
+
+        IntrusiveEventsInDomain<cpp_active_objects::EventQueue<>>(*pool);
+        IntrusiveEventsInDomain<cpp_active_objects::SpscEventQueue<16>>(*pool);
+        IntrusiveEventsInDomain<cpp_active_objects::IntrusiveEventQueue<>>(*pool);
+        IntrusiveEventsInDomain<cpp_active_objects::LockFreeEventQueue<>>(*pool);
+        IntrusiveEventsInDomain<cpp_active_objects::PriorityEventQueue<>>(*pool);
+        IntrusiveEventsInThreadPool(*pool);
+        IntrusiveEventsToSharedPtrOnlyObject(*pool);
+        InterfaceDefaults(*pool);
+
+        cpp_active_objects_embedded::EventQueue<8> event_queue;
+        EmbeddedIntrusiveEventsInDomain(*pool, event_queue);
+        cpp_active_objects_embedded::SpscEventQueue<8> spsc_queue;
+        EmbeddedIntrusiveEventsInDomain(*pool, spsc_queue);
+        // Intrusive events carry no queue link: needs a fallback resource
+        cpp_active_objects_embedded::IntrusiveEventQueue<> intrusive_queue(std::pmr::new_delete_resource());
+        EmbeddedIntrusiveEventsInDomain(*pool, intrusive_queue);
+        cpp_active_objects_embedded::PriorityEventQueue<8> priority_queue;
+        EmbeddedIntrusiveEventsInDomain(*pool, priority_queue);
+    }
+};
+} // namespace
+
+void EventQueuesFixtureMain()
+{
+    EventQueuesFixture::LockFreeEventQueueOrdering();
+    EventQueuesFixture::SpliceFront();
+    EventQueuesFixture::EmbeddedEnqueueFrontRange();
+    EventQueuesFixture::EventQueueBatch();
+    EventQueuesFixture::EmbeddedEventQueueBatch();
+    EventQueuesFixture::HighPrioDuringBatch();
+    EventQueuesFixture::IntrusiveEventQueueOrdering();
+    EventQueuesFixture::IntrusiveEventQueueEmbeddedDomain();
+    EventQueuesFixture::LockFreeEventQueueMultiProducer();
+    EventQueuesFixture::WaitStrategies();
+    EventQueuesFixture::PriorityEventQueueOrdering();
+    EventQueuesFixture::PriorityEventQueueDomain();
+    EventQueuesFixture::PriorityEventQueueDeregistration();
+    EventQueuesFixture::EmbeddedPriorityEventQueueOrdering();
+    EventQueuesFixture::SpscEventQueueOrdering();
+    EventQueuesFixture::SpscEventQueueFrontFromForeignThread();
+    EventQueuesFixture::EmbeddedSpscEventQueueFrontCapacity();
+    EventQueuesFixture::SpscEventQueueEmbeddedDomain();
+    EventQueuesFixture::IntrusiveEvents();
+}
@@ -8,14 +8,23 @@
  *
  */
 
+#include <algorithm>
+#include <array>
+#include <cstring>
 #include <iostream>
+#include <mutex>
+#include <new>
 #include <ostream>
+#include <thread>
 #include <vector>
 
 #include <cpp_event_framework/Pool.hxx>
+#include <cpp_event_framework/SizeClassPool.hxx>
 #include <cpp_event_framework/Signal.hxx>
+#include <cpp_event_framework/SignalVisitor.hxx>
 #include <cpp_event_framework/Statemachine.hxx>
 #include <cpp_event_framework/StaticPool.hxx>
+#include <cpp_event_framework/ThreadCachingPool.hxx>
 
 using namespace std::chrono_literals;
 
@@ -70,6 +79,135 @@ class PooledSimpleTestEvent2 : public cpp_event_framework::NextSignal<PooledSimp
 {
 };
 
+class StatelessTestEvent
+    : public cpp_event_framework::SignalBase<StatelessTestEvent, 40, cpp_event_framework::Signal, EventPoolAllocator>
+{
+public:
+    static constexpr bool kStateless = true;
+};
+
+class CachedPoolAllocator : public cpp_event_framework::CustomAllocator<CachedPoolAllocator>
+{
+};
+
+class CachedPooledTestEvent
+    : public cpp_event_framework::SignalBase<CachedPooledTestEvent, 5, cpp_event_framework::Signal, CachedPoolAllocator>
+{
+};
+
+class SizeClassAllocator : public cpp_event_framework::CustomAllocator<SizeClassAllocator>
+{
+};
+
+class SmallSizeClassEvent
+    : public cpp_event_framework::SignalBase<SmallSizeClassEvent, 10, cpp_event_framework::Signal, SizeClassAllocator>
+{
+};
+
+class SmallSizeClassEvent2 : public cpp_event_framework::NextSignal<SmallSizeClassEvent2, SmallSizeClassEvent>
+{
+};
+
+class LargeSizeClassEvent : public cpp_event_framework::NextSignal<LargeSizeClassEvent, SmallSizeClassEvent2>
+{
+public:
+    std::array<uint8_t, 2048> payload_ = {};
+};
+
+using SizeClassCalculator =
+    cpp_event_framework::SignalPoolElementSizeCalculator<SmallSizeClassEvent, LargeSizeClassEvent, SmallSizeClassEvent2>;
+
+class IntrusiveAllocator : public cpp_event_framework::CustomAllocator<IntrusiveAllocator>
+{
+};
+
+class IntrusiveTestEvent
+    : public cpp_event_framework::SignalBase<IntrusiveTestEvent, 20, cpp_event_framework::RefCountedSignal<>,
+                                             IntrusiveAllocator>
+{
+public:
+    explicit IntrusiveTestEvent(int val) : val_(val)
+    {
+    }
+
+    const int val_;
+};
+
+class IntrusiveTestEvent2 : public cpp_event_framework::NextSignal<IntrusiveTestEvent2, IntrusiveTestEvent,
+                                                                   cpp_event_framework::RefCountedSignal<>>
+{
+};
+
+class LocalIntrusiveTestEvent
+    : public cpp_event_framework::SignalBase<LocalIntrusiveTestEvent, 30,
+                                             cpp_event_framework::RefCountedSignal<false>>
+{
+};
+
+class IntrusiveFsmImpl;
+class IntrusiveFsm
+    : public cpp_event_framework::Statemachine<IntrusiveFsmImpl, const cpp_event_framework::RefCountedSignal<>::IPtr&>
+{
+public:
+    static const State kIdle;
+    static const State kBusy;
+
+private:
+    static Transition IdleHandler(ImplPtr /*impl*/, Event event)
+    {
+        return IntrusiveTestEvent::Check(event) ? TransitionTo(kBusy) : UnhandledEvent();
+    }
+    static Transition BusyHandler(ImplPtr /*impl*/, Event event)
+    {
+        return IntrusiveTestEvent2::Check(event) ? TransitionTo(kIdle) : UnhandledEvent();
+    }
+};
+
+class IntrusiveFsmImpl
+{
+public:
+    IntrusiveFsm fsm_;
+};
+
+const IntrusiveFsm::State IntrusiveFsm::kIdle("Idle", &IntrusiveFsm::IdleHandler);
+const IntrusiveFsm::State IntrusiveFsm::kBusy("Busy", &IntrusiveFsm::BusyHandler);
+
+class VisitorFsmImpl;
+class VisitorFsm : public cpp_event_framework::Statemachine<VisitorFsmImpl, const cpp_event_framework::Signal::SPtr&>
+{
+public:
+    static const State kIdle;
+    static const State kBusy;
+
+private:
+    static Transition IdleHandler(ImplPtr impl, Event event)
+    {
+        static const auto kVisitor = cpp_event_framework::MakeSignalVisitor<Transition, ImplPtr>(
+            [](const cpp_event_framework::Signal& /*event*/, ImplPtr /*impl*/) { return UnhandledEvent(); },
+            cpp_event_framework::On<PayloadTestEvent>(
+                [](const PayloadTestEvent& payload_event, ImplPtr /*impl*/)
+                { return payload_event.payload_.empty() ? UnhandledEvent() : TransitionTo(kBusy); }));
+        return kVisitor(event, impl);
+    }
+    static Transition BusyHandler(ImplPtr impl, Event event)
+    {
+        static const auto kVisitor = cpp_event_framework::MakeSignalVisitor<Transition, ImplPtr>(
+            [](const cpp_event_framework::Signal& /*event*/, ImplPtr /*impl*/) { return UnhandledEvent(); },
+            cpp_event_framework::On<SimpleTestEvent>([](const SimpleTestEvent& /*event*/, ImplPtr /*impl*/)
+                                                     { return TransitionTo(kIdle); }));
+        return kVisitor(event, impl);
+    }
+};
+
+class VisitorFsmImpl
+{
+public:
+    VisitorFsm fsm_;
+};
+
+const VisitorFsm::State VisitorFsm::kIdle("Idle", &VisitorFsm::IdleHandler);
+const VisitorFsm::State VisitorFsm::kBusy("Busy", &VisitorFsm::BusyHandler);
+
 using PoolSizeCalculator =
     cpp_event_framework::SignalPoolElementSizeCalculator<PooledSimpleTestEvent, PooledSimpleTestEvent2>;
 
@@ -100,6 +238,8 @@ public:
 
         assert(pool->FillLevel() == 10);
         {
+            // No payload, but no opt-in to be stateless: allocated
+            static_assert(sizeof(PooledSimpleTestEvent) == sizeof(cpp_event_framework::Signal));
             auto event = PooledSimpleTestEvent::MakeShared();
             assert(pool->FillLevel() == 9);
 
@@ -107,6 +247,183 @@ public:
             assert(pool->FillLevel() == 8);
         }
         assert(pool->FillLevel() == 10);
+
+        // Stateless signals are not allocated from pool
+        {
+            auto event = StatelessTestEvent::MakeShared();
+            auto event2 = StatelessTestEvent::MakeShared();
+            assert(event == event2);
+            assert(event.use_count() == 0);
+            assert(StatelessTestEvent::Check(event));
+            assert(pool->FillLevel() == 10);
+        }
+    }
+
+    static void GrowingPool()
+    {
+        constexpr auto kElementSize = 16;
+        cpp_event_framework::Pool<> pool(kElementSize, 4, "growing",
+                                         {.slab_size = 4, .max_size = 12});
+        assert(pool.Size() == 4);
+
+        std::vector<void*> elements;
+        for (int i = 0; i < 12; i++)
+        {
+            elements.emplace_back(pool.allocate(kElementSize));
+        }
+        assert(pool.Size() == 12);
+        assert(pool.NumSlabs() == 3);
+        assert(pool.FillLevel() == 0);
+        assert(pool.HighWatermark() == 12);
+
+        // Deallocation never releases slabs
+        pool.deallocate(elements.back(), kElementSize);
+        elements.pop_back();
+        assert(pool.NumSlabs() == 3);
+        // Last grown slab has an element in use
+        assert(pool.Trim() == 0);
+        assert(pool.NumSlabs() == 3);
+
+        // Keep two elements of initial slab in use -> both grown slabs are completely free and released
+        while (elements.size() > 2)
+        {
+            pool.deallocate(elements.back(), kElementSize);
+            elements.pop_back();
+        }
+        assert(pool.Size() == 12);
+        assert(pool.Trim() == 8);
+        assert(pool.Size() == 4);
+        assert(pool.NumSlabs() == 1);
+        assert(pool.FillLevel() == 2);
+        assert(pool.HighWatermark() == 12);
+
+        for (auto* element : elements)
+        {
+            pool.deallocate(element, kElementSize);
+        }
+        assert(pool.FillLevel() == 4);
+        assert(pool.Trim() == 0);
+    }
+
+    static void IntrusiveSignals()
+    {
+        using Calculator =
+            cpp_event_framework::SignalPoolElementSizeCalculator<IntrusiveTestEvent, IntrusiveTestEvent2>;
+        // No control block
+        static_assert(Calculator::kHeapSize < Calculator::kSptrSize);
+        static_assert(sizeof(IntrusiveTestEvent::IPtr) == sizeof(void*));
+
+        auto pool = cpp_event_framework::Pool<>::MakeShared(Calculator::kHeapSize, 4, "IntrusivePool");
+        IntrusiveAllocator::SetAllocator(pool);
+        {
+            auto event = IntrusiveTestEvent::MakeIntrusive(42);
+            assert(pool->FillLevel() == 3);
+
+            cpp_event_framework::RefCountedSignal<>::IPtr generic = event;
+            assert(IntrusiveTestEvent::Check(generic));
+            assert(!IntrusiveTestEvent2::Check(generic));
+            assert(IntrusiveTestEvent::FromSignal(generic)->val_ == 42);
+            std::cout << generic << "\n";
+
+            event.reset();
+            assert(pool->FillLevel() == 3);
+            generic.reset();
+            assert(pool->FillLevel() == 4);
+        }
+        assert(pool->FillLevel() == 4);
+
+        {
+            auto local = LocalIntrusiveTestEvent::MakeIntrusive();
+            auto copy = local;
+            assert(copy == local);
+        }
+
+        IntrusiveFsmImpl impl;
+        impl.fsm_.Init(&impl, "IntrusiveFsm");
+        impl.fsm_.Start(&IntrusiveFsm::kIdle);
+        impl.fsm_.React(IntrusiveTestEvent::MakeIntrusive(1));
+        assert(impl.fsm_.CurrentState() == &IntrusiveFsm::kBusy);
+        impl.fsm_.React(IntrusiveTestEvent2::MakeIntrusive());
+        assert(impl.fsm_.CurrentState() == &IntrusiveFsm::kIdle);
+        assert(pool->FillLevel() == 4);
+    }
+
+    static void SizeClassPool()
+    {
+        static_assert(SizeClassCalculator::kSptrSizeClasses.size() == 2);
+        static_assert(SizeClassCalculator::kSptrSizeClasses.at(1) == SizeClassCalculator::kSptrSize);
+
+        using PoolType = cpp_event_framework::SizeClassPool<SizeClassCalculator::kSptrSizeClasses>;
+        static_assert(PoolType::ClassIndex(1) == 0);
+        static_assert(PoolType::ClassIndex(SizeClassCalculator::kSptrSizeClasses.at(0) + 1) == 1);
+
+        auto pool = PoolType::MakeShared({10, 2}, "SizeClassPool");
+        SizeClassAllocator::SetAllocator(pool);
+        assert(pool->FillLevel(0) == 10);
+        assert(pool->FillLevel(1) == 2);
+        {
+            auto small = SmallSizeClassEvent::MakeShared();
+            auto small2 = SmallSizeClassEvent2::MakeShared();
+            auto large = LargeSizeClassEvent::MakeShared();
+            assert(pool->FillLevel(0) == 8);
+            assert(pool->FillLevel(1) == 1);
+            std::cout << *pool << "\n";
+        }
+        assert(pool->FillLevel(0) == 10);
+        assert(pool->FillLevel(1) == 2);
+
+        // Larger than all size classes: upstream resource, default throws
+        constexpr auto kLargeSize = SizeClassCalculator::kSptrSize + 1;
+        static_assert(PoolType::ClassIndex(kLargeSize) == PoolType::kNumClasses);
+        bool thrown = false;
+        try
+        {
+            (void)pool->allocate(kLargeSize);
+        }
+        catch (const std::bad_alloc&)
+        {
+            thrown = true;
+        }
+        assert(thrown);
+
+        PoolType upstream_pool({1, 1}, "SizeClassPoolUpstream", std::pmr::new_delete_resource());
+        auto* large = upstream_pool.allocate(kLargeSize);
+        assert(large != nullptr);
+        assert(upstream_pool.FillLevel(0) == 1);
+        assert(upstream_pool.FillLevel(1) == 1);
+        upstream_pool.deallocate(large, kLargeSize);
+    }
+
+    static void SignalVisitor()
+    {
+        int payload_sum = 0;
+        constexpr auto kVisitor = cpp_event_framework::MakeSignalVisitor<int, int&>(
+            [](const cpp_event_framework::Signal& /*event*/, int& /*sum*/) { return -1; },
+            cpp_event_framework::On<SimpleTestEvent>([](const SimpleTestEvent& /*event*/, int& /*sum*/) { return 0; }),
+            cpp_event_framework::On<PayloadTestEvent>(
+                [](const PayloadTestEvent& event, int& sum)
+                {
+                    sum += event.payload_.at(1);
+                    return 2;
+                }));
+        static_assert(decltype(kVisitor)::kTableSize == 3);
+
+        assert(kVisitor(SimpleTestEvent::MakeShared(), payload_sum) == 0);
+        assert(kVisitor(SimpleTestEvent2::MakeShared(), payload_sum) == -1);
+        assert(kVisitor(*PayloadTestEvent::MakeShared(std::vector<uint8_t>({1, 2, 3})), payload_sum) == 2);
+        assert(payload_sum == 2);
+        // Outside of table
+        assert(kVisitor(TestEventWithBaseClass::MakeShared(1), payload_sum) == -1);
+
+        VisitorFsmImpl impl;
+        impl.fsm_.Init(&impl, "VisitorFsm");
+        impl.fsm_.Start(&VisitorFsm::kIdle);
+        impl.fsm_.React(SimpleTestEvent::MakeShared());
+        assert(impl.fsm_.CurrentState() == &VisitorFsm::kIdle);
+        impl.fsm_.React(PayloadTestEvent::MakeShared(std::vector<uint8_t>({1, 2, 3})));
+        assert(impl.fsm_.CurrentState() == &VisitorFsm::kBusy);
+        impl.fsm_.React(SimpleTestEvent::MakeShared());
+        assert(impl.fsm_.CurrentState() == &VisitorFsm::kIdle);
     }
 
     static void DispatchEvent(const cpp_event_framework::Signal::SPtr& event)
@@ -184,6 +501,264 @@ public:
         assert(elem3 != elem2);
         assert(pool.FillLevel() == kPoolSize - 3);
     }
+
+    static void LockFreeStaticPool()
+    {
+        constexpr auto kPoolSize = 64;
+        constexpr auto kElementSize = sizeof(PooledSimpleTestEvent);
+        constexpr auto kThreads = 4;
+
+        cpp_event_framework::StaticPool<kPoolSize, kElementSize, std::mutex,
+                                        cpp_event_framework::DefaultAssertionProvider, sizeof(uint64_t), true>
+            pool("lockfree");
+        assert(pool.FillLevel() == kPoolSize);
+
+        {
+            std::vector<std::jthread> threads;
+            for (int t = 0; t < kThreads; t++)
+            {
+                threads.emplace_back(
+                    [&pool]()
+                    {
+                        std::vector<void*> elements;
+                        for (int round = 0; round < 1000; round++)
+                        {
+                            for (int i = 0; i < kPoolSize / kThreads; i++)
+                            {
+                                auto* element = pool.do_allocate(kElementSize, 1);
+                                assert(element != nullptr);
+                                // Scribble over element to detect double allocation
+                                memset(element, 0xA5, kElementSize);
+                                elements.emplace_back(element);
+                            }
+                            for (auto* element : elements)
+                            {
+                                pool.do_deallocate(element, kElementSize, 1);
+                            }
+                            elements.clear();
+                        }
+                    });
+            }
+        }
+        assert(pool.FillLevel() == kPoolSize);
+
+        // All elements distinct
+        std::vector<void*> elements;
+        for (int i = 0; i < kPoolSize; i++)
+        {
+            elements.emplace_back(pool.do_allocate(kElementSize, 1));
+        }
+        assert(pool.FillLevel() == 0);
+        std::sort(elements.begin(), elements.end());
+        assert(std::adjacent_find(elements.begin(), elements.end()) == elements.end());
+        for (auto* element : elements)
+        {
+            pool.do_deallocate(element, kElementSize, 1);
+        }
+        assert(pool.FillLevel() == kPoolSize);
+    }
+
+    static void LockFreeStaticPoolFillLevel()
+    {
+        constexpr auto kPoolSize = 16;
+        constexpr auto kElementSize = sizeof(PooledSimpleTestEvent);
+        constexpr auto kThreads = 4;
+
+        cpp_event_framework::StaticPool<kPoolSize, kElementSize, std::mutex,
+                                        cpp_event_framework::DefaultAssertionProvider, sizeof(uint64_t), true>
+            pool("lockfree_fill_level");
+
+        // Keep the pool nearly empty so elements are passed between threads right after being freed,
+        // FillLevel() must stay within [0, kPoolSize] (no transient underflow)
+        std::vector<void*> reserved;
+        for (int i = 0; i < kPoolSize - kThreads; i++)
+        {
+            reserved.emplace_back(pool.do_allocate(kElementSize, 1));
+        }
+
+        std::atomic<bool> done = false;
+        {
+            std::jthread monitor(
+                [&pool, &done]()
+                {
+                    while (!done)
+                    {
+                        assert(pool.FillLevel() <= kThreads);
+                    }
+                });
+
+            {
+                std::vector<std::jthread> threads;
+                for (int t = 0; t < kThreads; t++)
+                {
+                    threads.emplace_back(
+                        [&pool]()
+                        {
+                            for (int round = 0; round < 200000; round++)
+                            {
+                                auto* element = pool.do_allocate(kElementSize, 1);
+                                assert(pool.FillLevel() <= kThreads);
+                                pool.do_deallocate(element, kElementSize, 1);
+                                assert(pool.FillLevel() <= kThreads);
+                            }
+                        });
+                }
+            }
+            done = true;
+        }
+        assert(pool.FillLevel() == kThreads);
+
+        for (auto* element : reserved)
+        {
+            pool.do_deallocate(element, kElementSize, 1);
+        }
+        assert(pool.FillLevel() == kPoolSize);
+    }
+
+    static void ThreadCachingPool()
+    {
+        constexpr auto kPoolSize = 256;
+        constexpr auto kEvents = 10000;
+        constexpr auto kElementSize =
+            cpp_event_framework::SignalPoolElementSizeCalculator<CachedPooledTestEvent>::kSptrSize;
+
+        auto pool = cpp_event_framework::Pool<>::MakeShared(kElementSize, kPoolSize, "CachedPool");
+        auto caching_pool = std::make_shared<cpp_event_framework::ThreadCachingPool<8>>(pool, kElementSize);
+        CachedPoolAllocator::SetAllocator(caching_pool);
+
+        // Warm-up: single elements from upstream, no magazine is taken from a fixed size upstream in advance
+        {
+            auto event = CachedPooledTestEvent::MakeShared();
+            assert(pool->FillLevel() == kPoolSize - 1);
+            assert(caching_pool->DepotLevel() == 0);
+            assert(caching_pool->ThreadCacheLevel() == 0);
+        }
+        assert(caching_pool->ThreadCacheLevel() == 1);
+        caching_pool->FlushThreadCache();
+        caching_pool->Trim();
+        assert(pool->FillLevel() == kPoolSize);
+
+        // Allocate on producer thread, free on consumer thread: all frees are remote
+        std::mutex mutex;
+        std::vector<cpp_event_framework::Signal::SPtr> in_flight;
+        {
+            std::jthread producer(
+                [&]()
+                {
+                    for (int i = 0; i < kEvents; i++)
+                    {
+                        auto event = CachedPooledTestEvent::MakeShared();
+                        std::unique_lock lock(mutex);
+                        in_flight.emplace_back(std::move(event));
+                        // Keep pool from running empty
+                        while (in_flight.size() >= kPoolSize / 4)
+                        {
+                            lock.unlock();
+                            std::this_thread::yield();
+                            lock.lock();
+                        }
+                    }
+                });
+
+            auto consumed = 0;
+            while (consumed != kEvents)
+            {
+                std::vector<cpp_event_framework::Signal::SPtr> events;
+                {
+                    std::scoped_lock lock(mutex);
+                    events.swap(in_flight);
+                }
+                consumed += static_cast<int>(events.size());
+            }
+        }
+
+        // Producer thread cache went to depot on thread exit, consumer (this thread) cache holds the rest
+        assert(pool->FillLevel() + caching_pool->DepotLevel() + caching_pool->ThreadCacheLevel() == kPoolSize);
+        caching_pool->FlushThreadCache();
+        caching_pool->Trim();
+        assert(caching_pool->DepotLevel() == 0);
+        assert(pool->FillLevel() == kPoolSize);
+    }
+
+    static void ThreadCachingPoolRemoteFree()
+    {
+        constexpr size_t kPoolSize = 64;
+        constexpr size_t kElements = 20;
+        constexpr size_t kElementSize = 32;
+
+        auto pool = cpp_event_framework::Pool<>::MakeShared(kElementSize, kPoolSize, "RemoteFreePool");
+        cpp_event_framework::ThreadCachingPool<8> caching_pool(pool, kElementSize);
+
+        // Depot is empty: all allocations go to upstream
+        std::vector<void*> elements;
+        {
+            std::jthread allocating_thread(
+                [&]()
+                {
+                    for (size_t i = 0; i < kElements; i++)
+                    {
+                        elements.emplace_back(caching_pool.allocate(kElementSize));
+                    }
+                    assert(caching_pool.ThreadCacheLevel() == 0);
+                });
+        }
+        assert(pool->FillLevel() == kPoolSize - kElements);
+        assert(caching_pool.DepotLevel() == 0);
+
+        // Remote free: magazine holds 16, 17th free hands the oldest 8 to the depot
+        {
+            std::jthread freeing_thread(
+                [&]()
+                {
+                    for (auto* element : elements)
+                    {
+                        caching_pool.deallocate(element, kElementSize);
+                    }
+                    assert(caching_pool.ThreadCacheLevel() == 12);
+                    assert(caching_pool.DepotLevel() == 8);
+                });
+        }
+
+        // Thread exit moved the freeing thread's cache to the depot
+        assert(caching_pool.DepotLevel() == kElements);
+        assert(pool->FillLevel() == kPoolSize - kElements);
+
+        // Refill takes one magazine from the depot
+        auto* element = caching_pool.allocate(kElementSize);
+        assert(caching_pool.DepotLevel() == kElements - 8);
+        assert(caching_pool.ThreadCacheLevel() == 7);
+        caching_pool.deallocate(element, kElementSize);
+        caching_pool.FlushThreadCache();
+        assert(caching_pool.ThreadCacheLevel() == 0);
+        assert(caching_pool.DepotLevel() == kElements);
+        caching_pool.Trim();
+        assert(pool->FillLevel() == kPoolSize);
+    }
+
+    static void ThreadCachingPoolDestroyedElsewhere()
+    {
+        constexpr size_t kElementSize = 32;
+        using CachingPool = cpp_event_framework::ThreadCachingPool<8>;
+
+        auto pool = cpp_event_framework::Pool<>::MakeShared(kElementSize, 4, "DestroyedElsewherePool");
+        const auto entries = CachingPool::NumThreadCacheEntries();
+
+        auto first = std::make_shared<CachingPool>(pool, kElementSize);
+        first->deallocate(first->allocate(kElementSize), kElementSize);
+        first->FlushThreadCache();
+        assert(CachingPool::NumThreadCacheEntries() == entries + 1);
+
+        // Destroyed by another thread: this thread's entry is stale and dropped when a pool is used next
+        {
+            std::jthread destroying_thread([first = std::move(first)]() mutable { first.reset(); });
+        }
+        assert(CachingPool::NumThreadCacheEntries() == entries + 1);
+        assert(pool->FillLevel() == 4);
+
+        CachingPool second(pool, kElementSize);
+        second.deallocate(second.allocate(kElementSize), kElementSize);
+        assert(CachingPool::NumThreadCacheEntries() == entries + 1);
+    }
 };
 
 void EventsFixtureMain()
@@ -191,6 +766,15 @@ void EventsFixtureMain()
     EventsFixture::BasicTest();
     EventsFixture::SignalBaseClass();
     EventsFixture::PooledSignals();
+    EventsFixture::GrowingPool();
+    EventsFixture::SizeClassPool();
+    EventsFixture::IntrusiveSignals();
     EventsFixture::UsageInSwitchCase();
+    EventsFixture::SignalVisitor();
     EventsFixture::StaticPool();
+    EventsFixture::LockFreeStaticPool();
+    EventsFixture::LockFreeStaticPoolFillLevel();
+    EventsFixture::ThreadCachingPool();
+    EventsFixture::ThreadCachingPoolRemoteFree();
+    EventsFixture::ThreadCachingPoolDestroyedElsewhere();
 }
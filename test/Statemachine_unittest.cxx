@@ -1,9 +1,14 @@
 #include <iostream>
 #include <ostream>
+#include <string>
+#include <vector>
 
+#include <cpp_event_framework/OrthogonalRegions.hxx>
 #include <cpp_event_framework/Pool.hxx>
 #include <cpp_event_framework/Signal.hxx>
 #include <cpp_event_framework/Statemachine.hxx>
+#include <cpp_event_framework/StaticStatemachine.hxx>
+#include <cpp_event_framework/StatemachineFleet.hxx>
 
 class EvtGoYellow : public cpp_event_framework::SignalBase<EvtGoYellow, 0>
 {
@@ -296,6 +301,65 @@ public:
         fsm_.React(EvtTurnOn::MakeShared());
         assert(fsm_.CurrentState() == &Fsm::kYellow);
     }
+
+    void Fleet()
+    {
+        cpp_event_framework::StatemachineFleet<Fsm> fleet(this, "Fleet");
+        const auto a = fleet.Add(&Fsm::kOff);
+        const auto b = fleet.Add(&Fsm::kOff);
+        const auto c = fleet.Add(&Fsm::kOff);
+        assert(fleet.Size() == 3);
+
+        fleet.React(a, EvtTurnOn::MakeShared());
+        fleet.React(b, EvtTurnOn::MakeShared());
+        fleet.React(b, EvtGoYellow::MakeShared());
+        assert(fleet.CurrentState(a) == &Fsm::kGreen);
+        assert(fleet.CurrentState(b) == &Fsm::kYellow);
+        assert(fleet.CurrentState(c) == &Fsm::kOff);
+        assert(fleet.CountInState(Fsm::kOn) == 2);
+        assert(fleet.CountInState(Fsm::kYellow) == 1);
+
+        assert(fleet.ReactAllInState(Fsm::kOn, EvtTurnOff::MakeShared()) == 2);
+        assert(fleet.CountInState(Fsm::kOff) == 3);
+
+        // History is kept per instance
+        assert(fleet.ReactAllInState(Fsm::kOff, EvtTurnOn::MakeShared()) == 3);
+        assert(fleet.CurrentState(a) == &Fsm::kGreen);
+        assert(fleet.CurrentState(b) == &Fsm::kYellow);
+        assert(fleet.CurrentState(c) == &Fsm::kGreen);
+        assert(fleet.CurrentInstance() == cpp_event_framework::StatemachineFleet<Fsm>::kNoInstance);
+    }
+
+    void TwoFleets()
+    {
+        // Fleets of the same type index states independently, in a different order here
+        cpp_event_framework::StatemachineFleet<Fsm> first(this, "First");
+        cpp_event_framework::StatemachineFleet<Fsm> second(this, "Second");
+        const auto a = first.Add(&Fsm::kOff);
+        const auto b = second.Add(&Fsm::kOn);
+        const auto c = second.Add(&Fsm::kOff);
+        assert(first.CurrentState(a) == &Fsm::kOff);
+        assert(second.CurrentState(b) == &Fsm::kGreen);
+        assert(second.CurrentState(c) == &Fsm::kOff);
+
+        second.React(b, EvtGoYellow::MakeShared());
+        first.React(a, EvtTurnOn::MakeShared());
+        assert(first.CurrentState(a) == &Fsm::kGreen);
+        assert(second.CurrentState(b) == &Fsm::kYellow);
+        assert(first.CountInState(Fsm::kOn) == 1);
+        assert(first.CountInState(Fsm::kYellow) == 0);
+        assert(second.CountInState(Fsm::kOn) == 1);
+        assert(second.CountInState(Fsm::kOff) == 1);
+
+        // History is kept per fleet
+        assert(second.ReactAllInState(Fsm::kOn, EvtTurnOff::MakeShared()) == 1);
+        assert(first.ReactAllInState(Fsm::kOn, EvtTurnOff::MakeShared()) == 1);
+        assert(second.ReactAllInState(Fsm::kOff, EvtTurnOn::MakeShared()) == 2);
+        assert(first.ReactAllInState(Fsm::kOff, EvtTurnOn::MakeShared()) == 1);
+        assert(first.CurrentState(a) == &Fsm::kGreen);
+        assert(second.CurrentState(b) == &Fsm::kYellow);
+        assert(second.CurrentState(c) == &Fsm::kGreen);
+    }
 };
 
 const std::array<Fsm::State::EntryExitType, 2> Fsm::FsmOffEntryActions =
@@ -405,6 +469,609 @@ Fsm::Transition Fsm::FsmRedYellowHandler(ImplPtr /*impl*/, Event event)
     }
 }
 
+namespace
+{
+class DeepFsmImpl;
+class DeepFsm : public cpp_event_framework::Statemachine<DeepFsmImpl, const cpp_event_framework::Signal::SPtr&>
+{
+public:
+    static const State kA1;
+    static const State kA2;
+    static const State kA3;
+    static const State kA4;
+    static const State kB2;
+    static const State kB3;
+    // Nested deeper than kCachedStateDepth
+    static const State kC2;
+    static const State kC3;
+    static const State kC4;
+    static const State kC5;
+    static const State kC6;
+    static const State kC7;
+    static const State kC8;
+    static const State kC9;
+    static const State kC10;
+    static const State kC11;
+    static const State kD10;
+
+private:
+    static Transition A4Handler(ImplPtr /*impl*/, Event event)
+    {
+        return EvtGoRed::Check(event) ? TransitionTo(kB3) : UnhandledEvent();
+    }
+    static Transition B3Handler(ImplPtr /*impl*/, Event event)
+    {
+        if (EvtGoYellow::Check(event))
+        {
+            return TransitionTo(kC2);
+        }
+        return EvtGoGreen::Check(event) ? TransitionTo(kA2) : UnhandledEvent();
+    }
+    static Transition C11Handler(ImplPtr /*impl*/, Event event)
+    {
+        return EvtTurnOn::Check(event) ? TransitionTo(kD10) : UnhandledEvent();
+    }
+    static Transition DefaultHandler(ImplPtr /*impl*/, Event /*event*/)
+    {
+        return UnhandledEvent();
+    }
+};
+
+const DeepFsm::State DeepFsm::kA1("A1", &DeepFsm::DefaultHandler, nullptr, &kA2);
+const DeepFsm::State DeepFsm::kA2("A2", &DeepFsm::DefaultHandler, &kA1, &kA3);
+const DeepFsm::State DeepFsm::kA3("A3", &DeepFsm::DefaultHandler, &kA2, &kA4);
+const DeepFsm::State DeepFsm::kA4("A4", &DeepFsm::A4Handler, &kA3);
+const DeepFsm::State DeepFsm::kB2("B2", &DeepFsm::DefaultHandler, &kA1, &kB3);
+const DeepFsm::State DeepFsm::kB3("B3", &DeepFsm::B3Handler, &kB2);
+const DeepFsm::State DeepFsm::kC2("C2", &DeepFsm::DefaultHandler, &kA1, &kC3);
+const DeepFsm::State DeepFsm::kC3("C3", &DeepFsm::DefaultHandler, &kC2, &kC4);
+const DeepFsm::State DeepFsm::kC4("C4", &DeepFsm::DefaultHandler, &kC3, &kC5);
+const DeepFsm::State DeepFsm::kC5("C5", &DeepFsm::DefaultHandler, &kC4, &kC6);
+const DeepFsm::State DeepFsm::kC6("C6", &DeepFsm::DefaultHandler, &kC5, &kC7);
+const DeepFsm::State DeepFsm::kC7("C7", &DeepFsm::DefaultHandler, &kC6, &kC8);
+const DeepFsm::State DeepFsm::kC8("C8", &DeepFsm::DefaultHandler, &kC7, &kC9);
+const DeepFsm::State DeepFsm::kC9("C9", &DeepFsm::DefaultHandler, &kC8, &kC10);
+const DeepFsm::State DeepFsm::kC10("C10", &DeepFsm::DefaultHandler, &kC9, &kC11);
+const DeepFsm::State DeepFsm::kC11("C11", &DeepFsm::C11Handler, &kC10);
+const DeepFsm::State DeepFsm::kD10("D10", &DeepFsm::DefaultHandler, &kC9);
+
+class DeepFsmImpl
+{
+public:
+    DeepFsm fsm_;
+    std::vector<std::string> trace_;
+
+    void Main()
+    {
+        fsm_.on_state_entry_ = [](DeepFsm::Ref fsm, DeepFsm::StateRef state)
+        { fsm.Implementation()->trace_.emplace_back(std::string("+") + state.Name()); };
+        fsm_.on_state_exit_ = [](DeepFsm::Ref fsm, DeepFsm::StateRef state)
+        { fsm.Implementation()->trace_.emplace_back(std::string("-") + state.Name()); };
+        fsm_.Init(this, "DeepFsm");
+
+        assert(DeepFsm::kA4.Depth() == 4);
+        assert(DeepFsm::kA4.Ancestor(1) == &DeepFsm::kA2);
+        assert(DeepFsm::FindCommonParent(&DeepFsm::kA4, &DeepFsm::kB3) == &DeepFsm::kA1);
+        assert(DeepFsm::FindCommonParent(&DeepFsm::kA4, &DeepFsm::kA2) == &DeepFsm::kA2);
+
+        fsm_.Start(&DeepFsm::kA1);
+        assert(fsm_.CurrentState() == &DeepFsm::kA4);
+        assert((trace_ == std::vector<std::string>{"+A1", "+A2", "+A3", "+A4"}));
+
+        trace_.clear();
+        fsm_.React(EvtGoRed::MakeShared());
+        assert(fsm_.CurrentState() == &DeepFsm::kB3);
+        assert((trace_ == std::vector<std::string>{"-A4", "-A3", "-A2", "+B2", "+B3"}));
+
+        trace_.clear();
+        fsm_.React(EvtGoGreen::MakeShared());
+        assert(fsm_.CurrentState() == &DeepFsm::kA4);
+        assert((trace_ == std::vector<std::string>{"-B3", "-B2", "+A2", "+A3", "+A4"}));
+
+        // Ancestors below kCachedStateDepth are found via parent pointers
+        static_assert(DeepFsm::kCachedStateDepth < 10);
+        assert(DeepFsm::kC11.Depth() == 11);
+        assert(DeepFsm::kC11.Ancestor(2) == &DeepFsm::kC3);
+        assert(DeepFsm::kC11.Ancestor(9) == &DeepFsm::kC10);
+        assert(DeepFsm::kC11.Ancestor(10) == &DeepFsm::kC11);
+        assert(DeepFsm::FindCommonParent(&DeepFsm::kC11, &DeepFsm::kD10) == &DeepFsm::kC9);
+
+        fsm_.React(EvtGoRed::MakeShared());
+        trace_.clear();
+        fsm_.React(EvtGoYellow::MakeShared());
+        assert(fsm_.CurrentState() == &DeepFsm::kC11);
+        assert((trace_ == std::vector<std::string>{"-B3", "-B2", "+C2", "+C3", "+C4", "+C5", "+C6", "+C7", "+C8",
+                                                   "+C9", "+C10", "+C11"}));
+
+        trace_.clear();
+        fsm_.React(EvtTurnOn::MakeShared());
+        assert(fsm_.CurrentState() == &DeepFsm::kD10);
+        assert((trace_ == std::vector<std::string>{"-C11", "-C10", "+D10"}));
+    }
+};
+
+// Compile-time tracer, calls are resolved statically
+class Tracer : public cpp_event_framework::NoStatemachineHooks
+{
+public:
+    static inline std::vector<std::string> trace_;
+
+    template <typename Fsm>
+    static void OnStateEntry(const Fsm& /*fsm*/, typename Fsm::StateRef state)
+    {
+        trace_.emplace_back(std::string("+") + state.Name());
+    }
+    template <typename Fsm>
+    static void OnStateExit(const Fsm& /*fsm*/, typename Fsm::StateRef state)
+    {
+        trace_.emplace_back(std::string("-") + state.Name());
+    }
+};
+
+// Declares hooks that do not match their signature: rejected by Statemachine::Init()
+class MistypedTracer : public cpp_event_framework::NoStatemachineHooks
+{
+public:
+    static void OnStateEntry(int /*fsm*/)
+    {
+    }
+};
+
+class PrivateTracer : public cpp_event_framework::NoStatemachineHooks
+{
+private:
+    template <typename Fsm>
+    static void OnStateExit(const Fsm& /*fsm*/, typename Fsm::StateRef /*state*/)
+    {
+    }
+};
+
+// Compile-time hooks that support event deferral
+class DeferringTracer : public cpp_event_framework::NoStatemachineHooks
+{
+public:
+    template <typename Fsm>
+    static void OnDeferEvent(const Fsm& /*fsm*/, typename Fsm::StateRef /*state*/, typename Fsm::Event /*event*/)
+    {
+    }
+    template <typename Fsm>
+    static void OnRecallDeferredEvents(const Fsm& /*fsm*/, typename Fsm::StateRef /*state*/)
+    {
+    }
+};
+
+template <typename Fsm>
+concept CanDeferEvents = requires(Fsm fsm) {
+    Fsm::DeferEvent();
+    fsm.RecallEvents();
+};
+
+template <typename Hooks>
+class ToggleFsm : public cpp_event_framework::Statemachine<ToggleFsm<Hooks>, const cpp_event_framework::Signal::SPtr&,
+                                                           8, cpp_event_framework::DefaultAssertionProvider, Hooks>
+{
+public:
+    using Base = cpp_event_framework::Statemachine<ToggleFsm<Hooks>, const cpp_event_framework::Signal::SPtr&, 8,
+                                                   cpp_event_framework::DefaultAssertionProvider, Hooks>;
+
+    static inline const typename Base::State kOff{"Off", &ToggleFsm::OffHandler};
+    static inline const typename Base::State kOn{"On", &ToggleFsm::OnHandler};
+
+private:
+    static typename Base::Transition OffHandler(ToggleFsm* /*impl*/, typename Base::Event event)
+    {
+        return EvtGoGreen::Check(event) ? Base::TransitionTo(kOn) : Base::UnhandledEvent();
+    }
+    static typename Base::Transition OnHandler(ToggleFsm* /*impl*/, typename Base::Event event)
+    {
+        return EvtGoRed::Check(event) ? Base::TransitionTo(kOff) : Base::UnhandledEvent();
+    }
+};
+
+void HooksPolicy()
+{
+    static_assert(sizeof(ToggleFsm<cpp_event_framework::NoStatemachineHooks>) <
+                  sizeof(ToggleFsm<cpp_event_framework::RuntimeStatemachineHooks>));
+    static_assert(sizeof(ToggleFsm<Tracer>) == sizeof(ToggleFsm<cpp_event_framework::NoStatemachineHooks>));
+
+    static_assert(cpp_event_framework::detail::ValidStatemachineHooks<Tracer, ToggleFsm<Tracer>::Base>);
+    static_assert(
+        !cpp_event_framework::detail::ValidStatemachineHooks<MistypedTracer, ToggleFsm<MistypedTracer>::Base>);
+    static_assert(!cpp_event_framework::detail::ValidStatemachineHooks<PrivateTracer, ToggleFsm<PrivateTracer>::Base>);
+
+    static_assert(CanDeferEvents<ToggleFsm<cpp_event_framework::RuntimeStatemachineHooks>>);
+    static_assert(CanDeferEvents<ToggleFsm<DeferringTracer>>);
+    static_assert(!CanDeferEvents<ToggleFsm<cpp_event_framework::NoStatemachineHooks>>);
+    static_assert(!CanDeferEvents<ToggleFsm<Tracer>>);
+
+    ToggleFsm<Tracer> traced;
+    traced.Init(&traced, "Traced");
+    traced.Start(&ToggleFsm<Tracer>::kOff);
+    traced.React(EvtGoGreen::MakeShared());
+    traced.React(EvtGoYellow::MakeShared());
+    assert(traced.CurrentState() == &ToggleFsm<Tracer>::kOn);
+    assert((Tracer::trace_ == std::vector<std::string>{"+Off", "-Off", "+On"}));
+
+    ToggleFsm<cpp_event_framework::NoStatemachineHooks> plain;
+    plain.Init(&plain, "Plain");
+    plain.Start(&ToggleFsm<cpp_event_framework::NoStatemachineHooks>::kOff);
+    plain.React(EvtGoGreen::MakeShared());
+    plain.React(EvtGoRed::MakeShared());
+    assert(plain.CurrentState() == &ToggleFsm<cpp_event_framework::NoStatemachineHooks>::kOff);
+}
+
+void BatchReact()
+{
+    using Toggle = ToggleFsm<cpp_event_framework::NoStatemachineHooks>;
+    Toggle fsm;
+    fsm.Init(&fsm, "Batch");
+    fsm.Start(&Toggle::kOff);
+
+    const std::vector<cpp_event_framework::Signal::SPtr> events = {EvtGoGreen::MakeShared(), EvtGoYellow::MakeShared(),
+                                                                   EvtGoRed::MakeShared(), EvtGoGreen::MakeShared()};
+    assert(fsm.React(events) == events.size());
+    assert(fsm.CurrentState() == &Toggle::kOn);
+}
+
+// Counts failed assertions instead of aborting
+class CountingAssertionProvider
+{
+public:
+    static inline size_t failures_ = 0;
+
+    static void Assert(bool condition)
+    {
+        if (!condition)
+        {
+            failures_++;
+        }
+    }
+};
+
+// Three history states A, B, C with two substates each
+template <size_t NumHistoryStates>
+class HistoryFsm
+    : public cpp_event_framework::Statemachine<HistoryFsm<NumHistoryStates>, const cpp_event_framework::Signal::SPtr&,
+                                               NumHistoryStates, CountingAssertionProvider>
+{
+public:
+    using Base = cpp_event_framework::Statemachine<HistoryFsm<NumHistoryStates>,
+                                                   const cpp_event_framework::Signal::SPtr&, NumHistoryStates,
+                                                   CountingAssertionProvider>;
+
+    static const typename Base::HistoryState kA;
+    static const typename Base::State kA1;
+    static const typename Base::State kA2;
+    static const typename Base::HistoryState kB;
+    static const typename Base::State kB1;
+    static const typename Base::State kB2;
+    static const typename Base::HistoryState kC;
+    static const typename Base::State kC1;
+    static const typename Base::State kC2;
+
+    // Enter A, B and C once each and switch to their second substate, check history on re-entry
+    void SwitchToSecondSubstates()
+    {
+        this->React(EvtGoGreen::MakeShared());
+        this->React(EvtTurnOn::MakeShared());
+        assert(this->CurrentState() == &kA2);
+        this->React(EvtGoYellow::MakeShared());
+        this->React(EvtTurnOn::MakeShared());
+        assert(this->CurrentState() == &kB2);
+        this->React(EvtGoRed::MakeShared());
+        this->React(EvtTurnOn::MakeShared());
+        assert(this->CurrentState() == &kC2);
+    }
+
+private:
+    static typename Base::Transition TopHandler(HistoryFsm* /*impl*/, typename Base::Event event)
+    {
+        if (EvtGoGreen::Check(event))
+        {
+            return Base::TransitionTo(kA);
+        }
+        if (EvtGoYellow::Check(event))
+        {
+            return Base::TransitionTo(kB);
+        }
+        return EvtGoRed::Check(event) ? Base::TransitionTo(kC) : Base::UnhandledEvent();
+    }
+    static typename Base::Transition FirstSubstateHandler(HistoryFsm* impl, typename Base::Event event)
+    {
+        if (!EvtTurnOn::Check(event))
+        {
+            return Base::UnhandledEvent();
+        }
+        const auto* current = impl->CurrentState();
+        return Base::TransitionTo((current == &kA1) ? kA2 : ((current == &kB1) ? kB2 : kC2));
+    }
+    static typename Base::Transition SecondSubstateHandler(HistoryFsm* /*impl*/, typename Base::Event /*event*/)
+    {
+        return Base::UnhandledEvent();
+    }
+};
+
+template <size_t N>
+const typename HistoryFsm<N>::Base::HistoryState HistoryFsm<N>::kA("A", &HistoryFsm<N>::TopHandler, nullptr,
+                                                                   &HistoryFsm<N>::kA1);
+template <size_t N>
+const typename HistoryFsm<N>::Base::State HistoryFsm<N>::kA1("A1", &HistoryFsm<N>::FirstSubstateHandler,
+                                                             &HistoryFsm<N>::kA);
+template <size_t N>
+const typename HistoryFsm<N>::Base::State HistoryFsm<N>::kA2("A2", &HistoryFsm<N>::SecondSubstateHandler,
+                                                             &HistoryFsm<N>::kA);
+template <size_t N>
+const typename HistoryFsm<N>::Base::HistoryState HistoryFsm<N>::kB("B", &HistoryFsm<N>::TopHandler, nullptr,
+                                                                   &HistoryFsm<N>::kB1);
+template <size_t N>
+const typename HistoryFsm<N>::Base::State HistoryFsm<N>::kB1("B1", &HistoryFsm<N>::FirstSubstateHandler,
+                                                             &HistoryFsm<N>::kB);
+template <size_t N>
+const typename HistoryFsm<N>::Base::State HistoryFsm<N>::kB2("B2", &HistoryFsm<N>::SecondSubstateHandler,
+                                                             &HistoryFsm<N>::kB);
+template <size_t N>
+const typename HistoryFsm<N>::Base::HistoryState HistoryFsm<N>::kC("C", &HistoryFsm<N>::TopHandler, nullptr,
+                                                                   &HistoryFsm<N>::kC1);
+template <size_t N>
+const typename HistoryFsm<N>::Base::State HistoryFsm<N>::kC1("C1", &HistoryFsm<N>::FirstSubstateHandler,
+                                                             &HistoryFsm<N>::kC);
+template <size_t N>
+const typename HistoryFsm<N>::Base::State HistoryFsm<N>::kC2("C2", &HistoryFsm<N>::SecondSubstateHandler,
+                                                             &HistoryFsm<N>::kC);
+
+void HistorySlots()
+{
+    // Exactly NumHistoryStates history states: all slots used, no assertion
+    using Fitting = HistoryFsm<3>;
+    CountingAssertionProvider::failures_ = 0;
+    Fitting first;
+    first.Init(&first, "First");
+    first.Start(&Fitting::kA);
+    assert(first.CurrentState() == &Fitting::kA1);
+    first.SwitchToSecondSubstates();
+    first.React(EvtGoGreen::MakeShared());
+    assert(first.CurrentState() == &Fitting::kA2);
+    first.React(EvtGoYellow::MakeShared());
+    assert(first.CurrentState() == &Fitting::kB2);
+    first.React(EvtGoRed::MakeShared());
+    assert(first.CurrentState() == &Fitting::kC2);
+    assert(CountingAssertionProvider::failures_ == 0);
+
+    // Separate instances keep separate history slots
+    Fitting second;
+    second.Init(&second, "Second");
+    second.Start(&Fitting::kB);
+    assert(second.CurrentState() == &Fitting::kB1);
+    second.React(EvtGoGreen::MakeShared());
+    assert(second.CurrentState() == &Fitting::kA1);
+    second.React(EvtGoYellow::MakeShared());
+    assert(second.CurrentState() == &Fitting::kB1);
+    first.React(EvtGoYellow::MakeShared());
+    assert(first.CurrentState() == &Fitting::kB2);
+
+    // More history states than NumHistoryStates: assertion, C has no history
+    using Overflowing = HistoryFsm<2>;
+    Overflowing overflowing;
+    overflowing.Init(&overflowing, "Overflowing");
+    overflowing.Start(&Overflowing::kA);
+    overflowing.SwitchToSecondSubstates();
+    assert(CountingAssertionProvider::failures_ != 0);
+    overflowing.React(EvtGoGreen::MakeShared());
+    assert(overflowing.CurrentState() == &Overflowing::kA2);
+    overflowing.React(EvtGoRed::MakeShared());
+    assert(overflowing.CurrentState() == &Overflowing::kC1);
+    CountingAssertionProvider::failures_ = 0;
+}
+
+struct StaticOff;
+struct StaticOn;
+struct StaticGreen;
+struct StaticYellow;
+struct StaticOff : cpp_event_framework::StaticState<>
+{
+    static constexpr const char* kName = "Off";
+    static constexpr bool kHasEntry = true;
+    static constexpr bool kHasExit = true;
+};
+struct StaticOn : cpp_event_framework::StaticState<void, StaticGreen>
+{
+    static constexpr const char* kName = "On";
+    static constexpr bool kHasEntry = true;
+    static constexpr bool kHasExit = true;
+};
+struct StaticGreen : cpp_event_framework::StaticState<StaticOn>
+{
+    static constexpr const char* kName = "Green";
+    static constexpr bool kHasEntry = true;
+    static constexpr bool kHasExit = true;
+};
+struct StaticYellow : cpp_event_framework::StaticState<StaticOn>
+{
+    static constexpr const char* kName = "Yellow";
+    static constexpr bool kHasHandler = false;
+    static constexpr bool kHasEntry = true;
+    static constexpr bool kHasExit = true;
+};
+
+class StaticFsmImpl;
+using StaticFsm =
+    cpp_event_framework::StaticStatemachine<StaticFsmImpl, const cpp_event_framework::Signal::SPtr&,
+                                            cpp_event_framework::StaticStates<StaticOff, StaticOn, StaticGreen,
+                                                                              StaticYellow>>;
+
+class StaticFsmImpl
+{
+public:
+    StaticFsm fsm_;
+    std::vector<std::string> trace_;
+    size_t deferred_ = 0;
+    bool unhandled_ = false;
+
+    void Main()
+    {
+        fsm_.Init(this, "StaticFsm");
+        fsm_.Start<StaticOff>();
+        assert(fsm_.IsIn<StaticOff>());
+        assert((trace_ == std::vector<std::string>{"+Off"}));
+
+        fsm_.React(EvtGoYellow::MakeShared());
+        assert(deferred_ == 1);
+
+        trace_.clear();
+        fsm_.React(EvtTurnOn::MakeShared());
+        assert(fsm_.IsIn<StaticOn>() && fsm_.IsIn<StaticGreen>());
+        assert(std::string(fsm_.CurrentStateName()) == "Green");
+        assert((trace_ == std::vector<std::string>{"-Off", "+On", "+Green"}));
+
+        trace_.clear();
+        fsm_.React(EvtGoYellow::MakeShared());
+        assert(fsm_.CurrentStateIndex() == StaticFsm::kIndex<StaticYellow>);
+        assert((trace_ == std::vector<std::string>{"-Green", "action", "+Yellow"}));
+
+        // Yellow has no handler, parent handles event
+        trace_.clear();
+        fsm_.React(EvtTurnOff::MakeShared());
+        assert(fsm_.IsIn<StaticOff>());
+        assert((trace_ == std::vector<std::string>{"-Yellow", "-On", "+Off"}));
+
+        fsm_.React(EvtGoGreen::MakeShared());
+        assert(unhandled_);
+    }
+
+private:
+    friend StaticFsm;
+
+    StaticFsm::Transition Handle(StaticOff /*state*/, StaticFsm::Event event)
+    {
+        if (EvtTurnOn::Check(event))
+        {
+            return StaticFsm::TransitionTo<StaticOn>();
+        }
+        return EvtGoYellow::Check(event) ? StaticFsm::DeferEvent() : StaticFsm::UnhandledEvent();
+    }
+    StaticFsm::Transition Handle(StaticOn /*state*/, StaticFsm::Event event)
+    {
+        return EvtTurnOff::Check(event) ? StaticFsm::TransitionTo<StaticOff>() : StaticFsm::UnhandledEvent();
+    }
+    StaticFsm::Transition Handle(StaticGreen /*state*/, StaticFsm::Event event)
+    {
+        return EvtGoYellow::Check(event) ? StaticFsm::TransitionTo<StaticYellow>(&StaticFsmImpl::Action)
+                                         : StaticFsm::UnhandledEvent();
+    }
+
+    template <typename State>
+    void Entry(State /*state*/, StaticFsm::Event /*event*/)
+    {
+        trace_.emplace_back(std::string("+") + State::kName);
+    }
+    template <typename State>
+    void Exit(State /*state*/, StaticFsm::Event /*event*/)
+    {
+        trace_.emplace_back(std::string("-") + State::kName);
+    }
+    void Action(StaticFsm::Event /*event*/)
+    {
+        trace_.emplace_back("action");
+    }
+    void OnDeferEvent(StaticFsm::Event /*event*/)
+    {
+        deferred_++;
+    }
+    void OnUnhandledEvent(StaticFsm::Event /*event*/)
+    {
+        unhandled_ = true;
+    }
+};
+
+class RegionsImpl;
+class RegionAFsm : public cpp_event_framework::Statemachine<RegionsImpl, const cpp_event_framework::Signal::SPtr&>
+{
+public:
+    static const State kBusy;
+    static const State kIdle;
+
+private:
+    static Transition BusyHandler(ImplPtr /*impl*/, Event event)
+    {
+        if (EvtGoGreen::Check(event))
+        {
+            return TransitionTo(kIdle);
+        }
+        return EvtGoYellow::Check(event) ? DeferEvent() : UnhandledEvent();
+    }
+    static Transition IdleHandler(ImplPtr /*impl*/, Event event);
+};
+
+class RegionBFsm : public cpp_event_framework::Statemachine<RegionsImpl, const cpp_event_framework::Signal::SPtr&>
+{
+public:
+    static const State kCounting;
+
+private:
+    static Transition CountingHandler(ImplPtr /*impl*/, Event event);
+};
+
+class RegionsImpl
+{
+public:
+    cpp_event_framework::OrthogonalRegions<RegionAFsm, RegionBFsm> regions_;
+    size_t count_a_ = 0;
+    size_t count_b_ = 0;
+
+    void Main()
+    {
+        regions_.Region<0>().Init(this, "RegionA");
+        regions_.Region<1>().Init(this, "RegionB");
+        regions_.Start(&RegionAFsm::kBusy, &RegionBFsm::kCounting);
+
+        // Region A defers, region B handles the event
+        regions_.React(EvtGoYellow::MakeShared());
+        assert(count_a_ == 0);
+        assert(count_b_ == 1);
+        assert(regions_.NumDeferredEvents() == 1);
+
+        // Region A recalls on entry of kIdle - deferred event goes to region A only
+        regions_.React(EvtGoGreen::MakeShared());
+        assert(regions_.Region<0>().CurrentState() == &RegionAFsm::kIdle);
+        assert(count_a_ == 1);
+        assert(count_b_ == 1);
+        assert(regions_.NumDeferredEvents() == 0);
+
+        regions_.React(EvtGoYellow::MakeShared());
+        assert(count_a_ == 2);
+        assert(count_b_ == 2);
+    }
+
+    void IdleEntry(RegionAFsm::Event /*event*/)
+    {
+        regions_.Region<0>().RecallEvents();
+    }
+    void CountA(RegionAFsm::Event /*event*/)
+    {
+        count_a_++;
+    }
+    void CountB(RegionBFsm::Event /*event*/)
+    {
+        count_b_++;
+    }
+};
+
+const RegionAFsm::State RegionAFsm::kBusy("Busy", &RegionAFsm::BusyHandler);
+const RegionAFsm::State RegionAFsm::kIdle("Idle", &RegionAFsm::IdleHandler, nullptr, nullptr, &RegionsImpl::IdleEntry,
+                                          nullptr);
+const RegionBFsm::State RegionBFsm::kCounting("Counting", &RegionBFsm::CountingHandler);
+
+RegionAFsm::Transition RegionAFsm::IdleHandler(ImplPtr /*impl*/, Event event)
+{
+    return EvtGoYellow::Check(event) ? NoTransition(&RegionsImpl::CountA) : UnhandledEvent();
+}
+
+RegionBFsm::Transition RegionBFsm::CountingHandler(ImplPtr /*impl*/, Event event)
+{
+    return EvtGoYellow::Check(event) ? NoTransition(&RegionsImpl::CountB) : UnhandledEvent();
+}
+} // namespace
+
 void StatemachineFixtureMain()
 {
     StatemachineImpl fsm;
@@ -414,4 +1081,23 @@ void StatemachineFixtureMain()
 
     fsm.SetUp();
     fsm.History();
+
+    fsm.SetUp();
+    fsm.Fleet();
+
+    fsm.SetUp();
+    fsm.TwoFleets();
+
+    DeepFsmImpl deep_fsm;
+    deep_fsm.Main();
+
+    HooksPolicy();
+    BatchReact();
+    HistorySlots();
+
+    StaticFsmImpl static_fsm;
+    static_fsm.Main();
+
+    RegionsImpl regions;
+    regions.Main();
 }
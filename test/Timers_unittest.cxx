@@ -0,0 +1,267 @@
+/**
+ * @file Timers_unittest.cxx
+ * @author Dirk Ziegelmeier (dirk@ziegelmeier.net)
+ * @brief
+ * @date 16-10-2026
+ *
+ * @copyright SPDX-License-Identifier: Apache-2.0
+ *
+ */
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <cpp_active_objects/ActiveObjectBase.hxx>
+#include <cpp_active_objects/SingleThreadActiveObjectDomain.hxx>
+#include <cpp_active_objects/TimerService.hxx>
+#include <cpp_active_objects_embedded/ActiveObjectBase.hxx>
+#include <cpp_active_objects_embedded/EventQueue.hxx>
+#include <cpp_active_objects_embedded/SingleThreadActiveObjectDomain.hxx>
+#include <cpp_active_objects_embedded/TimerService.hxx>
+#include <cpp_event_framework/Signal.hxx>
+#include <cpp_event_framework/TimingWheel.hxx>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+struct TestTimer : public cpp_event_framework::TimingWheelNode
+{
+    uint64_t expired_at = 0;
+};
+
+class ArmSignal : public cpp_event_framework::SignalBase<ArmSignal, 0>
+{
+public:
+    ArmSignal(std::chrono::milliseconds delay, std::chrono::milliseconds period) : delay_(delay), period_(period)
+    {
+    }
+
+    const std::chrono::milliseconds delay_;
+    const std::chrono::milliseconds period_;
+};
+class DisarmSignal : public cpp_event_framework::NextSignal<DisarmSignal, ArmSignal>
+{
+};
+class Timeout : public cpp_event_framework::NextSignal<Timeout, DisarmSignal, cpp_active_objects::TimeEvent>
+{
+};
+class EmbeddedTimeout
+    : public cpp_event_framework::NextSignal<EmbeddedTimeout, DisarmSignal, cpp_active_objects_embedded::TimeEvent>
+{
+};
+
+class TimedActiveObject : public cpp_active_objects::ActiveObjectBase
+{
+public:
+    void Dispatch(const cpp_event_framework::Signal::SPtr& event) override
+    {
+        if (ArmSignal::Check(event))
+        {
+            auto arm = ArmSignal::FromSignal(event);
+            ArmTimer(timeout_, arm->delay_, arm->period_);
+        }
+        else if (DisarmSignal::Check(event))
+        {
+            DisarmTimer(*timeout_);
+        }
+        else if (Timeout::Check(event))
+        {
+            assert(event == timeout_);
+            timeouts_++;
+        }
+    }
+
+    Timeout::SPtr timeout_ = Timeout::MakeShared();
+    std::atomic<uint32_t> timeouts_ = 0;
+};
+
+class EmbeddedTimedActiveObject : public cpp_active_objects_embedded::ActiveObjectBase
+{
+public:
+    void Dispatch(const cpp_event_framework::Signal::SPtr& event) override
+    {
+        if (ArmSignal::Check(event))
+        {
+            auto arm = ArmSignal::FromSignal(event);
+            ArmTimer(timeout_, arm->delay_, arm->period_);
+        }
+        else if (EmbeddedTimeout::Check(event))
+        {
+            timeouts_++;
+        }
+    }
+
+    EmbeddedTimeout::SPtr timeout_ = EmbeddedTimeout::MakeShared();
+    std::atomic<uint32_t> timeouts_ = 0;
+};
+
+template <typename Predicate>
+bool WaitFor(Predicate predicate)
+{
+    for (int i = 0; i < 1000; i++)
+    {
+        if (predicate())
+        {
+            return true;
+        }
+        std::this_thread::sleep_for(1ms);
+    }
+    return false;
+}
+
+struct TimersFixture
+{
+    static void TimingWheelExactExpiry()
+    {
+        using Wheel = cpp_event_framework::TimingWheel<>;
+
+        Wheel wheel(12345);
+        std::vector<TestTimer> timers(2000);
+        std::mt19937_64 random(42);
+
+        // Delays on all levels, including delays that cross level boundaries
+        for (size_t i = 0; i < timers.size(); i++)
+        {
+            const uint64_t delay = 1 + (random() % (uint64_t(1) << (4 + (i % 24))));
+            wheel.Arm(timers.at(i), delay);
+        }
+        assert(wheel.Size() == timers.size());
+
+        // Cancel every 10th timer
+        for (size_t i = 0; i < timers.size(); i += 10)
+        {
+            assert(wheel.Cancel(timers.at(i)));
+            assert(!timers.at(i).IsArmed());
+        }
+        assert(!wheel.Cancel(timers.at(0)));
+
+        size_t expired = 0;
+        while (!wheel.Empty())
+        {
+            // Next event tick is never later than the earliest expiry
+            const auto next = wheel.NextEventTick();
+            for (const auto& timer : timers)
+            {
+                assert(!timer.IsArmed() || (timer.Expiry() >= next));
+            }
+
+            expired += wheel.Advance(wheel.Now() + 1 + (random() % 100000),
+                                     [&wheel](cpp_event_framework::TimingWheelNode& node)
+                                     {
+                                         auto& timer = static_cast<TestTimer&>(node);
+                                         assert(!timer.IsArmed());
+                                         assert(timer.Expiry() == wheel.Now());
+                                         timer.expired_at = wheel.Now();
+                                     });
+        }
+
+        assert(expired == timers.size() - (timers.size() / 10));
+        for (size_t i = 0; i < timers.size(); i++)
+        {
+            assert((timers.at(i).expired_at != 0) == ((i % 10) != 0));
+        }
+    }
+
+    static void TimingWheelRearmFromCallback()
+    {
+        cpp_event_framework::TimingWheel<> wheel;
+        TestTimer periodic;
+        TestTimer cancelled;
+        size_t count = 0;
+
+        wheel.Arm(periodic, 300);
+        wheel.Arm(cancelled, 300);
+        wheel.Advance(3000,
+                      [&](cpp_event_framework::TimingWheelNode& node)
+                      {
+                          // Both expire in the same tick, the first one cancels the second one
+                          assert(&node == &periodic);
+                          wheel.Cancel(cancelled);
+                          count++;
+                          wheel.Arm(periodic, 300);
+                      });
+        assert(count == 10);
+        assert(wheel.Size() == 1);
+        wheel.Clear();
+        assert(!periodic.IsArmed());
+    }
+
+    static void ActiveObjectTimeEvents()
+    {
+        auto object = std::make_shared<TimedActiveObject>();
+        {
+            auto domain = std::make_shared<cpp_active_objects::SingleThreadActiveObjectDomain<>>(
+                std::make_shared<cpp_active_objects::EventQueue<std::counting_semaphore<>>>());
+            domain->RegisterObject(object);
+
+            // One-shot
+            object->Take(ArmSignal::MakeShared(10ms, 0ms));
+            assert(WaitFor([&object]() { return object->timeouts_ == 1; }));
+            assert(!object->timeout_->IsArmed());
+
+            // Disarmed before expiry
+            object->Take(ArmSignal::MakeShared(200ms, 0ms));
+            object->Take(DisarmSignal::MakeShared());
+            std::this_thread::sleep_for(300ms);
+            assert(object->timeouts_ == 1);
+
+            // Periodic, left armed when domain is destroyed
+            object->Take(ArmSignal::MakeShared(5ms, 5ms));
+            assert(WaitFor([&object]() { return object->timeouts_ >= 4; }));
+        }
+
+        // Domain released time event and its target
+        assert(!object->timeout_->IsArmed());
+        assert(object->timeout_.use_count() == 1);
+        assert(object.use_count() == 1);
+    }
+
+    static void DeregisteredObjectTimeEvents()
+    {
+        auto object = std::make_shared<TimedActiveObject>();
+        auto domain = std::make_shared<cpp_active_objects::SingleThreadActiveObjectDomain<>>(
+            std::make_shared<cpp_active_objects::EventQueue<std::counting_semaphore<>>>());
+        const auto handle = domain->RegisterObjectWithHandle(object);
+
+        // Armed periodic timer holds the handle only, domain releases the object on deregistration
+        object->Take(ArmSignal::MakeShared(5ms, 5ms));
+        assert(WaitFor([&object]() { return object->timeouts_ >= 2; }));
+        domain->DeregisterObject(handle);
+        assert(WaitFor([&object]() { return object.use_count() == 1; }));
+
+        // Time events of the deregistered object are dropped
+        const uint32_t timeouts = object->timeouts_;
+        std::this_thread::sleep_for(50ms);
+        assert(object->timeouts_ == timeouts);
+    }
+
+    static void EmbeddedActiveObjectTimeEvents()
+    {
+        cpp_active_objects_embedded::EventQueue<8, std::counting_semaphore<>> queue;
+        EmbeddedTimedActiveObject object;
+        {
+            cpp_active_objects_embedded::SingleThreadActiveObjectDomain domain(&queue);
+            domain.RegisterObject(&object);
+
+            object.Take(ArmSignal::MakeShared(10ms, 0ms));
+            assert(WaitFor([&object]() { return object.timeouts_ == 1; }));
+        }
+        assert(object.timeout_.use_count() == 1);
+    }
+};
+} // namespace
+
+void TimersFixtureMain()
+{
+    TimersFixture::TimingWheelExactExpiry();
+    TimersFixture::TimingWheelRearmFromCallback();
+    TimersFixture::ActiveObjectTimeEvents();
+    TimersFixture::DeregisteredObjectTimeEvents();
+    TimersFixture::EmbeddedActiveObjectTimeEvents();
+}
@@ -3,7 +3,9 @@
 #include <iostream>
 
 extern void EventsFixtureMain();
+extern void EventQueuesFixtureMain();
 extern void StatemachineFixtureMain();
+extern void TimersFixtureMain();
 extern void InterfaceStatemachineExampleMain();
 extern void PimplStatemachineExampleMain();
 extern void SimpleStatemachineExampleMain();
@@ -17,6 +19,8 @@ int main(int, const char**)
     {
         StatemachineFixtureMain();
         EventsFixtureMain();
+        EventQueuesFixtureMain();
+        TimersFixtureMain();
         InterfaceStatemachineExampleMain();
         PimplStatemachineExampleMain();
         SimpleStatemachineExampleMain();